@@ -1244,6 +1244,14 @@ class V8_EXPORT ScriptCompiler {
     enum Encoding { ONE_BYTE, TWO_BYTE, UTF8 };
 
     StreamedSource(ExternalSourceStream* source_stream, Encoding encoding);
+
+    /**
+     * Creates a source whose data is already completely available in memory,
+     * e.g. a script that was loaded from disk. |length| is in bytes. The data
+     * is not copied up front and must be kept alive until the source has been
+     * compiled or destroyed.
+     */
+    StreamedSource(const uint8_t* data, size_t length, Encoding encoding);
     ~StreamedSource();
 
     // Ownership of the CachedData or its buffers is *not* transferred to the
@@ -1334,11 +1342,26 @@ class V8_EXPORT ScriptCompiler {
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
 
+  /**
+   * Starts streaming all of |sources| on the platform's background threads,
+   * so that several scripts are parsed in parallel. This is equivalent to
+   * creating a ScriptStreamingTask for each source with StartStreamingScript
+   * and posting it with Platform::CallOnBackgroundThread. Each source is then
+   * compiled on the main thread with Compile below, which first waits for the
+   * background work on that source to finish. The sources must be kept alive
+   * until then.
+   */
+  static void StartStreamingScripts(Isolate* isolate, StreamedSource** sources,
+                                    size_t count,
+                                    CompileOptions options = kNoCompileOptions);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
    * This can only be called after the streaming has finished
-   * (ScriptStreamingTask has been run). V8 doesn't construct the source string
+   * (ScriptStreamingTask has been run), unless the streaming was started with
+   * StartStreamingScripts, in which case this waits for it to finish.
+   * V8 doesn't construct the source string
    * during streaming, so the embedder needs to pass the full source here.
    */
   static V8_DEPRECATED("Use maybe version",
@@ -1406,6 +1429,26 @@ class V8_EXPORT ScriptCompiler {
       Local<String> arguments[], size_t context_extension_count,
       Local<Object> context_extensions[]);
 
+  /**
+   * Creates a code cache for a script that may already have run. Unlike the
+   * cache produced by kProduceCodeCache, which only contains the code that
+   * exists right after compilation, it also contains the code of all
+   * functions compiled lazily since then, so that consuming it skips their
+   * lazy compilation as well. Functions that were never compiled are left
+   * out and stay lazy.
+   *
+   * Bytecode is always included. Full-codegen code is only included if the
+   * script was compiled with kProduceCodeCache, because only then is lazily
+   * compiled code prepared for serialization.
+   *
+   * |source| must be the source the script was compiled from. The caller
+   * takes ownership of the result. Returns nullptr if no cache could be
+   * created, e.g. while a debugger is attached, or if the top-level code is
+   * full-codegen code and the script was not compiled with kProduceCodeCache.
+   */
+  static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script,
+                                     Local<String> source);
+
  private:
   static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundInternal(
       Isolate* isolate, Source* source, CompileOptions options, bool is_module);
@@ -5447,6 +5490,29 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about one of the caches of compiled scripts, evals and regular
+ * expressions kept by an isolate.
+ */
+class V8_EXPORT CompilationCacheStatistics {
+ public:
+  CompilationCacheStatistics();
+  const char* cache_name() { return cache_name_; }
+  size_t hits() { return hits_; }
+  size_t misses() { return misses_; }
+  size_t evictions() { return evictions_; }
+  size_t cache_size() { return cache_size_; }
+
+ private:
+  const char* cache_name_;
+  size_t hits_;
+  size_t misses_;
+  size_t evictions_;
+  size_t cache_size_;
+
+  friend class Isolate;
+};
+
 class RetainedObjectInfo;
 
 
@@ -5567,6 +5633,103 @@ enum JitCodeEventOptions {
  */
 typedef void (*JitCodeEventHandler)(const JitCodeEvent* event);
 
+/**
+ * A deoptimization event is issued each time optimized code of a JavaScript
+ * function bails out to unoptimized code.
+ */
+struct DeoptimizationEvent {
+  enum BailoutType { EAGER, LAZY, SOFT };
+
+  struct name_t {
+    // Name of the deoptimized function, note that the string is not
+    // zero-terminated.
+    const char* str;
+    // Number of chars in str.
+    size_t len;
+  };
+
+  // Kind of bailout that caused the deoptimization.
+  BailoutType type;
+  // Name of the function whose optimized code was deoptimized.
+  name_t name;
+  // Id of the script the function belongs to, or -1 if there is none.
+  int script_id;
+  // Script offset of the deoptimization point, or -1 if it is unknown.
+  int position;
+  // Human readable reason of the deoptimization.
+  const char* reason;
+  // True if V8 detected a deoptimization loop and will no longer optimize
+  // the function.
+  bool optimization_disabled;
+};
+
+
+/**
+ * Callback function passed to SetDeoptimizationEventHandler.
+ *
+ * \param event the deoptimization that is taking place.
+ */
+typedef void (*DeoptimizationEventHandler)(Isolate* isolate,
+                                           const DeoptimizationEvent* event);
+
+
+/**
+ * A function compilation event is issued each time a JavaScript function has
+ * been successfully compiled by one of V8's tiers.
+ */
+struct FunctionCompilationEvent {
+  struct name_t {
+    // Name of the compiled function, note that the string is not
+    // zero-terminated.
+    const char* str;
+    // Number of chars in str.
+    size_t len;
+  };
+
+  struct Phase {
+    // Name of the optimizing compiler phase.
+    const char* name;
+    // Wall time spent in the phase, in milliseconds.
+    double time_ms;
+    // Peak zone memory used by the phase, in bytes.
+    size_t max_allocated_bytes;
+  };
+
+  // Name of the compiled function.
+  name_t name;
+  // Id of the script the function belongs to, or -1 if there is none.
+  int script_id;
+  // Name of the compiler tier, e.g. "Ignition", "Full-Codegen", "TurboFan" or
+  // "Crankshaft".
+  const char* compiler;
+  // True if the code was compiled for on-stack replacement.
+  bool is_osr;
+  // Wall time spent in the prepare, execute and finalize steps of the
+  // compilation, in milliseconds.
+  double prepare_time_ms;
+  double execute_time_ms;
+  double finalize_time_ms;
+  // Peak zone memory used by the compilation, in bytes.
+  size_t max_allocated_bytes;
+  // Size of the generated code or bytecode including metadata, in bytes.
+  size_t code_size;
+  // Per-phase breakdown, only available for TurboFan compilations.
+  const Phase* phases;
+  size_t phase_count;
+  // Functions that were inlined into the optimized code.
+  const name_t* inlined_functions;
+  size_t inlined_function_count;
+};
+
+
+/**
+ * Callback function passed to SetFunctionCompilationEventHandler.
+ *
+ * \param event the compilation that just finished.
+ */
+typedef void (*FunctionCompilationEventHandler)(
+    Isolate* isolate, const FunctionCompilationEvent* event);
+
 
 /**
  * Interface for iterating through all external resources in the heap.
@@ -6025,6 +6188,24 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Returns the number of compilation caches of the isolate.
+   */
+  size_t NumberOfCompilationCaches();
+
+  /**
+   * Get the hit, miss and eviction counts of a compilation cache, and the
+   * estimated number of bytes retained by its entries.
+   *
+   * \param cache_statistics The CompilationCacheStatistics object to fill in
+   *   statistics.
+   * \param index The index of the cache to get statistics from, which ranges
+   *   from 0 to NumberOfCompilationCaches() - 1.
+   * \returns true on success.
+   */
+  bool GetCompilationCacheStatistics(
+      CompilationCacheStatistics* cache_statistics, size_t index);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -6437,6 +6618,36 @@ class V8_EXPORT Isolate {
   void SetJitCodeEventHandler(JitCodeEventOptions options,
                               JitCodeEventHandler event_handler);
 
+  /**
+   * Allows the host application to observe deoptimizations of optimized
+   * code, e.g. to detect functions that keep bouncing between optimized and
+   * unoptimized code.
+   *
+   * \param event_handler the deoptimization event handler, which will be
+   *     invoked each time optimized code of a JavaScript function is
+   *     deoptimized. Passing NULL removes the handler.
+   * \note the handler is invoked in the middle of a deoptimization. It must
+   *     not call into V8 and must not cause garbage collection.
+   * \note the event passed to \p event_handler and the strings it points to
+   *     are not guaranteed to live past each call.
+   */
+  void SetDeoptimizationEventHandler(DeoptimizationEventHandler event_handler);
+
+  /**
+   * Allows the host application to collect per-function compilation
+   * statistics, e.g. to find functions that are expensive to optimize.
+   *
+   * \param event_handler the compilation event handler, which will be
+   *     invoked on the main thread each time a function has been compiled.
+   *     Passing NULL removes the handler.
+   * \note the handler must not call into V8 and must not cause garbage
+   *     collection.
+   * \note the event passed to \p event_handler and the strings it points to
+   *     are not guaranteed to live past each call.
+   */
+  void SetFunctionCompilationEventHandler(
+      FunctionCompilationEventHandler event_handler);
+
   /**
    * Modifies the stack limit for this Isolate.
    *
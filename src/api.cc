@@ -29,6 +29,7 @@
 #include "src/bootstrapper.h"
 #include "src/char-predicates-inl.h"
 #include "src/code-stubs.h"
+#include "src/compilation-cache.h"
 #include "src/compiler.h"
 #include "src/context-measure.h"
 #include "src/contexts.h"
@@ -1739,11 +1740,49 @@ bool ScriptCompiler::ExternalSourceStream::SetBookmark() { return false; }
 void ScriptCompiler::ExternalSourceStream::ResetToBookmark() { UNREACHABLE(); }
 
 
+namespace {
+
+// Hands out a source that is completely available in memory in chunks, so that
+// it can go through the regular streaming machinery.
+class InMemorySourceStream : public ScriptCompiler::ExternalSourceStream {
+ public:
+  InMemorySourceStream(const uint8_t* data, size_t length)
+      : data_(data), length_(length), offset_(0) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    // Keep chunks even so that two-byte sources are never split in the middle
+    // of a code unit.
+    static const size_t kChunkSize = 64 * i::KB;
+    size_t length = i::Min(kChunkSize, length_ - offset_);
+    if (length == 0) return 0;
+    // The caller takes ownership of the chunk.
+    uint8_t* chunk = new uint8_t[length];
+    memcpy(chunk, data_ + offset_, length);
+    offset_ += length;
+    *src = chunk;
+    return length;
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t length_;
+  size_t offset_;
+};
+
+}  // namespace
+
+
 ScriptCompiler::StreamedSource::StreamedSource(ExternalSourceStream* stream,
                                                Encoding encoding)
     : impl_(new i::StreamedSource(stream, encoding)) {}
 
 
+ScriptCompiler::StreamedSource::StreamedSource(const uint8_t* data,
+                                               size_t length, Encoding encoding)
+    : impl_(new i::StreamedSource(new InMemorySourceStream(data, length),
+                                  encoding)) {}
+
+
 ScriptCompiler::StreamedSource::~StreamedSource() { delete impl_; }
 
 
@@ -2138,6 +2177,28 @@ Local<Function> ScriptCompiler::CompileFunctionInContext(
 }
 
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
+    Local<UnboundScript> unbound_script, Local<String> source) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  i::Isolate* isolate = shared->GetIsolate();
+  DCHECK(shared->is_toplevel());
+  if (!i::FLAG_serialize_toplevel || isolate->debug()->is_loaded()) {
+    return nullptr;
+  }
+  i::HandleScope scope(isolate);
+  i::ScriptData* script_data = i::CodeSerializer::SerializeAfterExecution(
+      isolate, shared, Utils::OpenHandle(*source));
+  if (script_data == nullptr) return nullptr;
+  CachedData* result = new CachedData(
+      script_data->data(), script_data->length(), CachedData::BufferOwned);
+  script_data->ReleaseDataOwnership();
+  delete script_data;
+  return result;
+}
+
+
 ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
     Isolate* v8_isolate, StreamedSource* source, CompileOptions options) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -2146,6 +2207,20 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
 }
 
 
+void ScriptCompiler::StartStreamingScripts(Isolate* v8_isolate,
+                                           StreamedSource** sources,
+                                           size_t count,
+                                           CompileOptions options) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  for (size_t i = 0; i < count; i++) {
+    i::V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new i::BackgroundParsingPlatformTask(sources[i]->impl(), options,
+                                             i::FLAG_stack_size, isolate),
+        v8::Platform::kShortRunningTask);
+  }
+}
+
+
 MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
                                            StreamedSource* v8_source,
                                            Local<String> full_source_string,
@@ -2153,6 +2228,7 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Script);
   TRACE_EVENT0("v8", "V8.ScriptCompiler");
   i::StreamedSource* source = v8_source->impl();
+  source->WaitForBackgroundParsing();
   i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
   i::Handle<i::Script> script = isolate->factory()->NewScript(str);
   if (!origin.ResourceName().IsEmpty()) {
@@ -5678,6 +5754,13 @@ HeapObjectStatistics::HeapObjectStatistics()
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
 
+CompilationCacheStatistics::CompilationCacheStatistics()
+    : cache_name_(nullptr),
+      hits_(0),
+      misses_(0),
+      evictions_(0),
+      cache_size_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -7740,6 +7823,28 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+size_t Isolate::NumberOfCompilationCaches() {
+  return i::CompilationCache::kSubCacheCount;
+}
+
+bool Isolate::GetCompilationCacheStatistics(
+    CompilationCacheStatistics* cache_statistics, size_t index) {
+  if (!cache_statistics) return false;
+  if (index >= NumberOfCompilationCaches()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  int cache_index = static_cast<int>(index);
+  i::CompilationSubCache* cache =
+      isolate->compilation_cache()->sub_cache(cache_index);
+  cache_statistics->cache_name_ =
+      i::CompilationCache::SubCacheName(cache_index);
+  cache_statistics->hits_ = cache->hits();
+  cache_statistics->misses_ = cache->misses();
+  cache_statistics->evictions_ = cache->evictions();
+  cache_statistics->cache_size_ = cache->size();
+  return true;
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -7972,6 +8077,20 @@ void Isolate::SetJitCodeEventHandler(JitCodeEventOptions options,
 }
 
 
+void Isolate::SetDeoptimizationEventHandler(
+    DeoptimizationEventHandler event_handler) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_deoptimization_event_handler(event_handler);
+}
+
+
+void Isolate::SetFunctionCompilationEventHandler(
+    FunctionCompilationEventHandler event_handler) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_function_compilation_event_handler(event_handler);
+}
+
+
 void Isolate::SetStackLimit(uintptr_t stack_limit) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   CHECK(stack_limit);
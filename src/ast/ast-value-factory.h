@@ -28,6 +28,8 @@
 #ifndef V8_AST_AST_VALUE_FACTORY_H_
 #define V8_AST_AST_VALUE_FACTORY_H_
 
+#include <algorithm>
+
 #include "src/api.h"
 #include "src/base/hashmap.h"
 #include "src/utils.h"
@@ -334,6 +336,7 @@ class AstValueFactory {
 #define F(name) name##_ = NULL;
     OTHER_CONSTANTS(F)
 #undef F
+    std::fill(smis_, smis_ + arraysize(smis_), nullptr);
   }
 
   Zone* zone() const { return zone_; }
@@ -432,6 +435,10 @@ class AstValueFactory {
 #define F(name) AstValue* name##_;
   OTHER_CONSTANTS(F)
 #undef F
+
+  // Small integer literals are very common, share their values.
+  static const int kMaxCachedSmi = (1 << 6) - 1;
+  AstValue* smis_[kMaxCachedSmi + 1];
 };
 }  // namespace internal
 }  // namespace v8
@@ -76,5 +76,20 @@ void BackgroundParsingTask::Run() {
   }
   source_->info->set_isolate(isolate);
 }
+
+
+BackgroundParsingPlatformTask::BackgroundParsingPlatformTask(
+    StreamedSource* source, ScriptCompiler::CompileOptions options,
+    int stack_size, Isolate* isolate)
+    : source_(source), task_(source, options, stack_size, isolate) {
+  DCHECK(!source_->parsing_done);
+  source_->parsing_done.reset(new base::Semaphore(0));
+}
+
+
+void BackgroundParsingPlatformTask::Run() {
+  task_.Run();
+  source_->parsing_done->Signal();
+}
 }  // namespace internal
 }  // namespace v8
@@ -7,6 +7,7 @@
 
 #include <memory>
 
+#include "include/v8-platform.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/semaphore.h"
 #include "src/compiler.h"
@@ -39,6 +40,21 @@ struct StreamedSource {
   std::unique_ptr<ParseInfo> info;
   std::unique_ptr<Parser> parser;
 
+  // Signalled once the background parsing task has finished if the task was
+  // posted to the platform by ScriptCompiler::StartStreamingScripts, as
+  // opposed to being run by the embedder.
+  std::unique_ptr<base::Semaphore> parsing_done;
+
+  ~StreamedSource() { WaitForBackgroundParsing(); }
+
+  // Blocks until background parsing posted to the platform has finished.
+  void WaitForBackgroundParsing() {
+    if (parsing_done) {
+      parsing_done->Wait();
+      parsing_done.reset();
+    }
+  }
+
   // Prevent copying.
   StreamedSource(const StreamedSource&) = delete;
   StreamedSource& operator=(const StreamedSource&) = delete;
@@ -58,6 +74,24 @@ class BackgroundParsingTask : public ScriptCompiler::ScriptStreamingTask {
   int stack_size_;
   ScriptData* script_data_;
 };
+
+
+// Runs a BackgroundParsingTask on one of the platform's background threads and
+// signals the source when it is done.
+class BackgroundParsingPlatformTask : public v8::Task {
+ public:
+  BackgroundParsingPlatformTask(StreamedSource* source,
+                                ScriptCompiler::CompileOptions options,
+                                int stack_size, Isolate* isolate);
+
+  void Run() override;
+
+ private:
+  StreamedSource* source_;  // Not owned.
+  BackgroundParsingTask task_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundParsingPlatformTask);
+};
 }  // namespace internal
 }  // namespace v8
 
@@ -51,6 +51,7 @@ namespace internal {
   V(kDefaultNaNModeNotSet, "Default NaN mode not set")                         \
   V(kDeleteWithGlobalVariable, "Delete with global variable")                  \
   V(kDeleteWithNonGlobalVariable, "Delete with non-global variable")           \
+  V(kDeoptimizationLoop, "Deoptimization loop")                                \
   V(kDestinationOfCopyNotAligned, "Destination of copy not aligned")           \
   V(kDontDeleteCellsCannotContainTheHole,                                      \
     "DontDelete cells can't contain the hole")                                 \
@@ -10,11 +10,24 @@
 #include <malloc.h>  // NOLINT
 #endif
 
+#include "src/base/logging.h"
+
 namespace v8 {
 namespace base {
 
+AccountingAllocator::AccountingAllocator() {
+  for (size_t i = 0; i < kNumberOfBuckets; ++i) pool_heads_[i] = nullptr;
+  for (int i = 0; i < kNumberOfZoneKinds; ++i) {
+    current_zone_kind_usage_[i] = 0;
+    max_zone_kind_usage_[i] = 0;
+  }
+}
+
+AccountingAllocator::~AccountingAllocator() { ClearPool(); }
+
 void* AccountingAllocator::Allocate(size_t bytes) {
-  void* memory = malloc(bytes);
+  void* memory = AllocateFromPool(bytes);
+  if (memory == nullptr) memory = malloc(bytes);
   if (memory) {
     AtomicWord current =
         NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
@@ -27,11 +40,35 @@ void* AccountingAllocator::Allocate(size_t bytes) {
 }
 
 void AccountingAllocator::Free(void* memory, size_t bytes) {
-  free(memory);
+  if (!ReturnToPool(memory, bytes)) free(memory);
   NoBarrier_AtomicIncrement(&current_memory_usage_,
                             -static_cast<AtomicWord>(bytes));
 }
 
+void AccountingAllocator::ConfigurePool(size_t max_pool_size) {
+  {
+    LockGuard<Mutex> lock_guard(&pool_mutex_);
+    max_pool_size_ = max_pool_size;
+  }
+  if (max_pool_size == 0) ClearPool();
+}
+
+void AccountingAllocator::ClearPool() {
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  for (size_t i = 0; i < kNumberOfBuckets; ++i) {
+    PooledBlock* block = pool_heads_[i];
+    while (block != nullptr) {
+      PooledBlock* next = block->next;
+      NoBarrier_AtomicIncrement(&current_pool_size_,
+                                -static_cast<AtomicWord>(block->size));
+      free(block);
+      block = next;
+    }
+    pool_heads_[i] = nullptr;
+  }
+  DCHECK_EQ(0, NoBarrier_Load(&current_pool_size_));
+}
+
 size_t AccountingAllocator::GetCurrentMemoryUsage() const {
   return NoBarrier_Load(&current_memory_usage_);
 }
@@ -40,5 +77,87 @@ size_t AccountingAllocator::GetMaxMemoryUsage() const {
   return NoBarrier_Load(&max_memory_usage_);
 }
 
+size_t AccountingAllocator::GetCurrentPoolSize() const {
+  return NoBarrier_Load(&current_pool_size_);
+}
+
+size_t AccountingAllocator::AccountZoneMemory(ZoneKind kind, intptr_t bytes) {
+  DCHECK_LT(kind, kNumberOfZoneKinds);
+  AtomicWord current =
+      NoBarrier_AtomicIncrement(&current_zone_kind_usage_[kind], bytes);
+  AtomicWord max = NoBarrier_Load(&max_zone_kind_usage_[kind]);
+  while (current > max) {
+    max = NoBarrier_CompareAndSwap(&max_zone_kind_usage_[kind], max, current);
+  }
+  return current;
+}
+
+size_t AccountingAllocator::GetCurrentMemoryUsage(ZoneKind kind) const {
+  DCHECK_LT(kind, kNumberOfZoneKinds);
+  return NoBarrier_Load(&current_zone_kind_usage_[kind]);
+}
+
+size_t AccountingAllocator::GetMaxMemoryUsage(ZoneKind kind) const {
+  DCHECK_LT(kind, kNumberOfZoneKinds);
+  return NoBarrier_Load(&max_zone_kind_usage_[kind]);
+}
+
+// static
+const char* AccountingAllocator::ZoneKindToString(ZoneKind kind) {
+  switch (kind) {
+    case kOtherZone:
+      return "V8.OtherZoneMemory";
+    case kParserZone:
+      return "V8.ParserZoneMemory";
+    case kTurboFanZone:
+      return "V8.TurboFanZoneMemory";
+    case kRegisterAllocatorZone:
+      return "V8.RegisterAllocatorZoneMemory";
+    case kNumberOfZoneKinds:
+      break;
+  }
+  UNREACHABLE();
+  return nullptr;
+}
+
+void* AccountingAllocator::AllocateFromPool(size_t bytes) {
+  // Every block in bucket i is at least 2^(kMinPooledSizePower + i) bytes,
+  // so round the request up to find a bucket whose blocks are large enough.
+  if (bytes > (static_cast<size_t>(1) << kMaxPooledSizePower)) return nullptr;
+  if (NoBarrier_Load(&current_pool_size_) == 0) return nullptr;
+  size_t power = kMinPooledSizePower;
+  while (bytes > (static_cast<size_t>(1) << power)) power++;
+
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  PooledBlock* block = pool_heads_[power - kMinPooledSizePower];
+  if (block == nullptr) return nullptr;
+  pool_heads_[power - kMinPooledSizePower] = block->next;
+  NoBarrier_AtomicIncrement(&current_pool_size_,
+                            -static_cast<AtomicWord>(block->size));
+  return block;
+}
+
+bool AccountingAllocator::ReturnToPool(void* memory, size_t bytes) {
+  // The caller only knows about {bytes} of the block, which may have come
+  // from a larger bucket; rounding down keeps the bucket invariant.
+  if (bytes < (static_cast<size_t>(1) << kMinPooledSizePower)) return false;
+  if (bytes >= (static_cast<size_t>(1) << (kMaxPooledSizePower + 1))) {
+    return false;
+  }
+  size_t power = kMinPooledSizePower;
+  while (bytes >= (static_cast<size_t>(1) << (power + 1))) power++;
+
+  LockGuard<Mutex> lock_guard(&pool_mutex_);
+  if (NoBarrier_Load(&current_pool_size_) + bytes > max_pool_size_) {
+    return false;
+  }
+  PooledBlock* block = reinterpret_cast<PooledBlock*>(memory);
+  block->next = pool_heads_[power - kMinPooledSizePower];
+  block->size = bytes;
+  pool_heads_[power - kMinPooledSizePower] = block;
+  NoBarrier_AtomicIncrement(&current_pool_size_, bytes);
+  return true;
+}
+
 }  // namespace base
 }  // namespace v8
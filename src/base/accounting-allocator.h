@@ -7,25 +7,77 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 namespace base {
 
 class AccountingAllocator {
  public:
-  AccountingAllocator() = default;
-  virtual ~AccountingAllocator() = default;
+  // Blocks with sizes in [2^kMinPooledSizePower, 2^(kMaxPooledSizePower+1)[
+  // are kept in a pool when freed, if pooling is enabled.
+  static const size_t kMinPooledSizePower = 13;  // 8 KB
+  static const size_t kMaxPooledSizePower = 20;  // 1 MB
+
+  // Zones attribute the memory they hold to one of these kinds, so that zone
+  // memory usage can be broken down by client.
+  enum ZoneKind {
+    kOtherZone,
+    kParserZone,
+    kTurboFanZone,
+    kRegisterAllocatorZone,
+    kNumberOfZoneKinds
+  };
+
+  AccountingAllocator();
+  virtual ~AccountingAllocator();
 
   // Returns nullptr on failed allocation.
   virtual void* Allocate(size_t bytes);
   virtual void Free(void* memory, size_t bytes);
 
+  // Sets the maximum number of bytes kept in the pool of recently freed
+  // blocks. A maximum of 0 (the default) disables pooling.
+  void ConfigurePool(size_t max_pool_size);
+
+  // Returns all pooled blocks to the system, e.g. on memory pressure.
+  void ClearPool();
+
   size_t GetCurrentMemoryUsage() const;
   size_t GetMaxMemoryUsage() const;
+  size_t GetCurrentPoolSize() const;
+
+  // Adds {bytes} (which may be negative) to the memory attributed to {kind}
+  // and returns the new total. Called by zones for their segments.
+  size_t AccountZoneMemory(ZoneKind kind, intptr_t bytes);
+
+  size_t GetCurrentMemoryUsage(ZoneKind kind) const;
+  size_t GetMaxMemoryUsage(ZoneKind kind) const;
+
+  static const char* ZoneKindToString(ZoneKind kind);
 
  private:
+  static const size_t kNumberOfBuckets =
+      kMaxPooledSizePower - kMinPooledSizePower + 1;
+
+  // Freed blocks are threaded through their first words.
+  struct PooledBlock {
+    PooledBlock* next;
+    size_t size;
+  };
+
+  void* AllocateFromPool(size_t bytes);
+  bool ReturnToPool(void* memory, size_t bytes);
+
   AtomicWord current_memory_usage_ = 0;
   AtomicWord max_memory_usage_ = 0;
+  AtomicWord current_pool_size_ = 0;
+  AtomicWord current_zone_kind_usage_[kNumberOfZoneKinds];
+  AtomicWord max_zone_kind_usage_[kNumberOfZoneKinds];
+
+  Mutex pool_mutex_;
+  size_t max_pool_size_ = 0;
+  PooledBlock* pool_heads_[kNumberOfBuckets];
 
   DISALLOW_COPY_AND_ASSIGN(AccountingAllocator);
 };
@@ -1061,6 +1061,11 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
               Operand(BYTECODE_ARRAY_TYPE));
   }
 
+  // Reset code age.
+  __ li(t0, Operand(BytecodeArray::kNoAgeBytecodeAge));
+  __ sb(t0, FieldMemOperand(kInterpreterBytecodeArrayRegister,
+                            BytecodeArray::kBytecodeAgeOffset));
+
   // Load initial bytecode offset.
   __ li(kInterpreterBytecodeOffsetRegister,
         Operand(BytecodeArray::kHeaderSize - kHeapObjectTag));
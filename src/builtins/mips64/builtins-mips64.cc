@@ -1053,6 +1053,11 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
               Operand(BYTECODE_ARRAY_TYPE));
   }
 
+  // Reset code age.
+  __ li(a4, Operand(BytecodeArray::kNoAgeBytecodeAge));
+  __ sb(a4, FieldMemOperand(kInterpreterBytecodeArrayRegister,
+                            BytecodeArray::kBytecodeAgeOffset));
+
   // Load initial bytecode offset.
   __ li(kInterpreterBytecodeOffsetRegister,
         Operand(BytecodeArray::kHeaderSize - kHeapObjectTag));
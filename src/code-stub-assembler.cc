@@ -7,6 +7,7 @@
 #include "src/frames-inl.h"
 #include "src/frames.h"
 #include "src/ic/handler-configuration.h"
+#include "src/ic/ic-state.h"
 #include "src/ic/stub-cache.h"
 
 namespace v8 {
@@ -3324,30 +3325,87 @@ void CodeStubAssembler::HandlePolymorphicCase(
   }
   Node* length = LoadAndUntagFixedArrayBaseLength(feedback);
 
-  // Loop from {unroll_count}*kEntrySize to {length}.
-  Variable var_index(this, MachineRepresentation::kWord32);
-  Label loop(this, &var_index);
-  var_index.Bind(Int32Constant(unroll_count * kEntrySize));
-  Goto(&loop);
-  Bind(&loop);
-  {
-    Node* index = var_index.value();
-    GotoIf(Int32GreaterThanOrEqual(index, length), if_miss);
+  // Feedback with more than kMaxLinearPolymorphicMapCount maps is sorted by
+  // map address (see FeedbackNexus::InstallHandlers), so binary search it.
+  Label linear_search(this), binary_search(this);
+  Branch(Int32GreaterThan(
+             length, Int32Constant(kMaxLinearPolymorphicMapCount * kEntrySize)),
+         &binary_search, &linear_search);
+
+  Bind(&binary_search);
+  {
+    // Search the entries in [lower, upper[. A cleared weak cell reads as
+    // Smi zero and may misdirect the search, which then ends in a miss that
+    // rewrites the feedback without it.
+    Variable var_lower(this, MachineRepresentation::kWord32);
+    Variable var_upper(this, MachineRepresentation::kWord32);
+    Variable* loop_vars[] = {&var_lower, &var_upper};
+    Label loop(this, 2, loop_vars);
+    var_lower.Bind(Int32Constant(0));
+    var_upper.Bind(Word32Shr(length, Int32Constant(1)));
+    Goto(&loop);
+    Bind(&loop);
+    {
+      Node* lower = var_lower.value();
+      Node* upper = var_upper.value();
+      GotoIf(Int32GreaterThanOrEqual(lower, upper), if_miss);
 
-    Node* cached_map =
-        LoadWeakCellValue(LoadFixedArrayElement(feedback, index));
+      Node* middle = Word32Shr(Int32Add(lower, upper), Int32Constant(1));
+      Node* index = Int32Mul(middle, Int32Constant(kEntrySize));
+      Node* cached_map =
+          LoadWeakCellValue(LoadFixedArrayElement(feedback, index));
 
-    Label next_entry(this);
-    GotoIf(WordNotEqual(receiver_map, cached_map), &next_entry);
+      Label if_found(this), if_not_found(this), if_lower(this),
+          if_higher(this);
+      Branch(WordEqual(receiver_map, cached_map), &if_found, &if_not_found);
 
-    // Found, now call handler.
-    Node* handler = LoadFixedArrayElement(feedback, index, kPointerSize);
-    var_handler->Bind(handler);
-    Goto(if_handler);
+      Bind(&if_found);
+      {
+        Node* handler = LoadFixedArrayElement(feedback, index, kPointerSize);
+        var_handler->Bind(handler);
+        Goto(if_handler);
+      }
 
-    Bind(&next_entry);
-    var_index.Bind(Int32Add(index, Int32Constant(kEntrySize)));
+      Bind(&if_not_found);
+      Branch(UintPtrLessThan(receiver_map, cached_map), &if_lower, &if_higher);
+
+      Bind(&if_lower);
+      var_upper.Bind(middle);
+      Goto(&loop);
+
+      Bind(&if_higher);
+      var_lower.Bind(Int32Add(middle, Int32Constant(1)));
+      Goto(&loop);
+    }
+  }
+
+  Bind(&linear_search);
+  {
+    // Loop from {unroll_count}*kEntrySize to {length}.
+    Variable var_index(this, MachineRepresentation::kWord32);
+    Label loop(this, &var_index);
+    var_index.Bind(Int32Constant(unroll_count * kEntrySize));
     Goto(&loop);
+    Bind(&loop);
+    {
+      Node* index = var_index.value();
+      GotoIf(Int32GreaterThanOrEqual(index, length), if_miss);
+
+      Node* cached_map =
+          LoadWeakCellValue(LoadFixedArrayElement(feedback, index));
+
+      Label next_entry(this);
+      GotoIf(WordNotEqual(receiver_map, cached_map), &next_entry);
+
+      // Found, now call handler.
+      Node* handler = LoadFixedArrayElement(feedback, index, kPointerSize);
+      var_handler->Bind(handler);
+      Goto(if_handler);
+
+      Bind(&next_entry);
+      var_index.Bind(Int32Add(index, Int32Constant(kEntrySize)));
+      Goto(&loop);
+    }
   }
 }
 
@@ -3452,6 +3510,8 @@ void CodeStubAssembler::TryProbeStubCache(
 
   Bind(&try_secondary);
   {
+    IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1);
+
     // Probe the secondary table.
     Node* secondary_offset = StubCacheSecondaryOffset(name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
@@ -4,10 +4,15 @@
 
 #include "src/compilation-cache.h"
 
+#include <iterator>
+
+#include "src/base/lazy-instance.h"
 #include "src/counters.h"
 #include "src/factory.h"
 #include "src/globals.h"
 #include "src/objects-inl.h"
+#include "src/parsing/preparse-data.h"
+#include "src/snapshot/code-serializer.h"
 
 namespace v8 {
 namespace internal {
@@ -53,11 +58,126 @@ Handle<CompilationCacheTable> CompilationSubCache::GetTable(int generation) {
 }
 
 
+namespace {
+
+// Estimates the number of bytes retained by a compilation cache entry. Inner
+// functions are not accounted for.
+size_t EntryCost(String* source, Object* value) {
+  int cost = source->Size();
+  if (value->IsSharedFunctionInfo()) {
+    SharedFunctionInfo* shared = SharedFunctionInfo::cast(value);
+    cost += SharedFunctionInfo::kSize;
+    if (shared->code()->kind() == Code::FUNCTION) {
+      cost += shared->code()->Size();
+    }
+    if (shared->HasBytecodeArray()) cost += shared->bytecode_array()->Size();
+  } else {
+    cost += HeapObject::cast(value)->Size();
+  }
+  return static_cast<size_t>(cost);
+}
+
+}  // namespace
+
+
+size_t CompilationSubCache::size() {
+  if (FLAG_compilation_cache_size > 0) return size_;
+  // Without a budget, entries are not tracked, so add up their cost here.
+  DisallowHeapAllocation no_gc;
+  size_t result = 0;
+  for (int i = 0; i < generations_; i++) {
+    if (tables_[i]->IsUndefined(isolate())) continue;
+    CompilationCacheTable* table = CompilationCacheTable::cast(tables_[i]);
+    for (int entry = 0, capacity = table->Capacity(); entry < capacity;
+         entry++) {
+      Object* key = table->KeyAt(entry);
+      Object* value =
+          table->get(CompilationCacheTable::EntryToIndex(entry) + 1);
+      if (value->IsSharedFunctionInfo()) {
+        // Script and eval keys hold the source at index 1.
+        result += EntryCost(String::cast(FixedArray::cast(key)->get(1)), value);
+      } else if (value->IsFixedArray()) {
+        FixedArray* data = FixedArray::cast(value);
+        result +=
+            EntryCost(String::cast(data->get(JSRegExp::kSourceIndex)), value);
+      }
+    }
+  }
+  return result;
+}
+
+
+void CompilationSubCache::RecordHit() {
+  hits_++;
+  isolate()->counters()->compilation_cache_hits()->Increment();
+}
+
+
+void CompilationSubCache::RecordMiss() {
+  misses_++;
+  isolate()->counters()->compilation_cache_misses()->Increment();
+}
+
+
+void CompilationSubCache::RecordUse(uint32_t hash, Handle<Object> value,
+                                    Handle<String> source) {
+  if (FLAG_compilation_cache_size <= 0) return;
+  DisallowHeapAllocation no_gc;
+  auto range = use_table_.equal_range(hash);
+  for (UseTable::iterator slot = range.first; slot != range.second; ++slot) {
+    if (slot->second->value == *value) {
+      uses_.splice(uses_.begin(), uses_, slot->second);
+      return;
+    }
+  }
+  Use use;
+  use.value = *value;
+  use.hash = hash;
+  use.cost = EntryCost(*source, *value);
+  size_ += use.cost;
+  uses_.push_front(use);
+  use_table_.insert(std::make_pair(hash, uses_.begin()));
+  EvictUntil(static_cast<size_t>(FLAG_compilation_cache_size) * KB);
+}
+
+
+void CompilationSubCache::EvictUntil(size_t max_size) {
+  int removed = 0;
+  while (size_ > max_size) {
+    DCHECK(!uses_.empty());
+    UseList::iterator last = std::prev(uses_.end());
+    auto range = use_table_.equal_range(last->hash);
+    UseTable::iterator slot = range.first;
+    while (slot->second != last) {
+      ++slot;
+      DCHECK(slot != range.second);
+    }
+    CompilationCacheTable::cast(tables_[kFirstGeneration])
+        ->RemoveEntry(last->hash, last->value);
+    EraseUse(slot);
+    removed++;
+  }
+  evictions_ += removed;
+  isolate()->counters()->compilation_cache_evictions()->Increment(removed);
+}
+
+
+void CompilationSubCache::EraseUse(UseTable::iterator slot) {
+  UseList::iterator use = slot->second;
+  size_ -= use->cost;
+  use_table_.erase(slot);
+  uses_.erase(use);
+}
+
+
 void CompilationSubCache::Age() {
-  // Don't directly age single-generation caches.
-  if (generations_ == 1) {
-    if (!tables_[0]->IsUndefined(isolate())) {
-      CompilationCacheTable::cast(tables_[0])->Age();
+  // Don't directly age single-generation caches, nor caches that are bounded
+  // in size and evict their least recently used entries instead.
+  if (generations_ == 1 || FLAG_compilation_cache_size > 0) {
+    for (int i = 0; i < generations_; i++) {
+      if (!tables_[i]->IsUndefined(isolate())) {
+        CompilationCacheTable::cast(tables_[i])->Age();
+      }
     }
     return;
   }
@@ -84,11 +204,17 @@ void CompilationSubCache::IterateFunctions(ObjectVisitor* v) {
 
 void CompilationSubCache::Iterate(ObjectVisitor* v) {
   v->VisitPointers(&tables_[0], &tables_[generations_]);
+  for (UseList::iterator it = uses_.begin(); it != uses_.end(); ++it) {
+    v->VisitPointer(&it->value);
+  }
 }
 
 
 void CompilationSubCache::Clear() {
   MemsetPointer(tables_, isolate()->heap()->undefined_value(), generations_);
+  use_table_.clear();
+  uses_.clear();
+  size_ = 0;
 }
 
 
@@ -101,6 +227,12 @@ void CompilationSubCache::Remove(Handle<SharedFunctionInfo> function_info) {
       table->Remove(*function_info);
     }
   }
+  for (UseTable::iterator slot = use_table_.begin();
+       slot != use_table_.end();) {
+    UseTable::iterator next = std::next(slot);
+    if (slot->second->value == *function_info) EraseUse(slot);
+    slot = next;
+  }
 }
 
 
@@ -147,13 +279,15 @@ Handle<SharedFunctionInfo> CompilationCacheScript::Lookup(
     Handle<Context> context, LanguageMode language_mode) {
   Object* result = NULL;
   int generation;
+  uint32_t hash = 0;
 
   // Probe the script generation tables. Make sure not to leak handles
   // into the caller's handle scope.
   { HandleScope scope(isolate());
     for (generation = 0; generation < generations(); generation++) {
       Handle<CompilationCacheTable> table = GetTable(generation);
-      Handle<Object> probe = table->Lookup(source, context, language_mode);
+      Handle<Object> probe =
+          table->Lookup(source, context, language_mode, &hash);
       if (probe->IsSharedFunctionInfo()) {
         Handle<SharedFunctionInfo> function_info =
             Handle<SharedFunctionInfo>::cast(probe);
@@ -178,11 +312,15 @@ Handle<SharedFunctionInfo> CompilationCacheScript::Lookup(
         HasOrigin(shared, name, line_offset, column_offset, resource_options));
     // If the script was found in a later generation, we promote it to
     // the first generation to let it survive longer in the cache.
-    if (generation != 0) Put(source, context, language_mode, shared);
-    isolate()->counters()->compilation_cache_hits()->Increment();
+    if (generation != 0) {
+      Put(source, context, language_mode, shared);
+    } else {
+      RecordUse(hash, shared, source);
+    }
+    RecordHit();
     return shared;
   } else {
-    isolate()->counters()->compilation_cache_misses()->Increment();
+    RecordMiss();
     return Handle<SharedFunctionInfo>::null();
   }
 }
@@ -194,8 +332,11 @@ void CompilationCacheScript::Put(Handle<String> source,
                                  Handle<SharedFunctionInfo> function_info) {
   HandleScope scope(isolate());
   Handle<CompilationCacheTable> table = GetFirstTable();
+  uint32_t hash;
   SetFirstTable(CompilationCacheTable::Put(table, source, context,
-                                           language_mode, function_info));
+                                           language_mode, function_info,
+                                           &hash));
+  RecordUse(hash, function_info, source);
 }
 
 
@@ -208,10 +349,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheEval::Lookup(
   // having cleared the cache.
   Handle<Object> result = isolate()->factory()->undefined_value();
   int generation;
+  uint32_t hash = 0;
   for (generation = 0; generation < generations(); generation++) {
     Handle<CompilationCacheTable> table = GetTable(generation);
-    result =
-        table->LookupEval(source, outer_info, language_mode, scope_position);
+    result = table->LookupEval(source, outer_info, language_mode,
+                               scope_position, &hash);
     if (result->IsSharedFunctionInfo()) break;
   }
   if (result->IsSharedFunctionInfo()) {
@@ -219,11 +361,13 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheEval::Lookup(
         Handle<SharedFunctionInfo>::cast(result);
     if (generation != 0) {
       Put(source, outer_info, function_info, scope_position);
+    } else {
+      RecordUse(hash, function_info, source);
     }
-    isolate()->counters()->compilation_cache_hits()->Increment();
+    RecordHit();
     return scope.CloseAndEscape(function_info);
   } else {
-    isolate()->counters()->compilation_cache_misses()->Increment();
+    RecordMiss();
     return MaybeHandle<SharedFunctionInfo>();
   }
 }
@@ -238,6 +382,17 @@ void CompilationCacheEval::Put(Handle<String> source,
   table = CompilationCacheTable::PutEval(table, source, outer_info,
                                          function_info, scope_position);
   SetFirstTable(table);
+  if (FLAG_compilation_cache_size > 0) {
+    // The first put of an eval only adds a hash of the source, which is not
+    // an entry to keep track of.
+    uint32_t hash;
+    Handle<Object> entry =
+        table->LookupEval(source, outer_info, function_info->language_mode(),
+                          scope_position, &hash);
+    if (*entry == *function_info) {
+      RecordUse(hash, function_info, source);
+    }
+  }
 }
 
 
@@ -250,20 +405,23 @@ MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(
   // having cleared the cache.
   Handle<Object> result = isolate()->factory()->undefined_value();
   int generation;
+  uint32_t hash = 0;
   for (generation = 0; generation < generations(); generation++) {
     Handle<CompilationCacheTable> table = GetTable(generation);
-    result = table->LookupRegExp(source, flags);
+    result = table->LookupRegExp(source, flags, &hash);
     if (result->IsFixedArray()) break;
   }
   if (result->IsFixedArray()) {
     Handle<FixedArray> data = Handle<FixedArray>::cast(result);
     if (generation != 0) {
       Put(source, flags, data);
+    } else {
+      RecordUse(hash, data, source);
     }
-    isolate()->counters()->compilation_cache_hits()->Increment();
+    RecordHit();
     return scope.CloseAndEscape(data);
   } else {
-    isolate()->counters()->compilation_cache_misses()->Increment();
+    RecordMiss();
     return MaybeHandle<FixedArray>();
   }
 }
@@ -274,7 +432,10 @@ void CompilationCacheRegExp::Put(Handle<String> source,
                                  Handle<FixedArray> data) {
   HandleScope scope(isolate());
   Handle<CompilationCacheTable> table = GetFirstTable();
-  SetFirstTable(CompilationCacheTable::PutRegExp(table, source, flags, data));
+  uint32_t hash;
+  SetFirstTable(
+      CompilationCacheTable::PutRegExp(table, source, flags, data, &hash));
+  RecordUse(hash, data, source);
 }
 
 
@@ -391,6 +552,15 @@ void CompilationCache::MarkCompactPrologue() {
 }
 
 
+// static
+const char* CompilationCache::SubCacheName(int index) {
+  static const char* const kNames[kSubCacheCount] = {
+      "script", "eval_global", "eval_contextual", "regexp"};
+  DCHECK(0 <= index && index < kSubCacheCount);
+  return kNames[index];
+}
+
+
 void CompilationCache::Enable() {
   enabled_ = true;
 }
@@ -402,5 +572,154 @@ void CompilationCache::Disable() {
 }
 
 
+static base::LazyInstance<SharedCompilationCache>::type
+    shared_compilation_cache = LAZY_INSTANCE_INITIALIZER;
+
+
+// Returns the characters of a flat string as raw bytes.
+static Vector<const byte> RawCharacters(const String::FlatContent& content) {
+  if (content.IsOneByte()) return content.ToOneByteVector();
+  Vector<const uc16> chars = content.ToUC16Vector();
+  return Vector<const byte>(reinterpret_cast<const byte*>(chars.start()),
+                            chars.length() * static_cast<int>(sizeof(uc16)));
+}
+
+
+SharedCompilationCache::SharedCompilationCache() : size_(0) {}
+
+
+SharedCompilationCache* SharedCompilationCache::Get() {
+  return shared_compilation_cache.Pointer();
+}
+
+
+ScriptData* SharedCompilationCache::Lookup(Handle<String> source) {
+  if (IsEmpty()) return nullptr;
+  uint32_t hash = SerializedCodeData::SourceContentHash(source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent();
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  EntryTable::iterator slot = Find(hash, content);
+  if (slot == table_.end()) return nullptr;
+  EntryList::iterator it = slot->second;
+  entries_.splice(entries_.begin(), entries_, it);
+  // Copy the data, as the entry may be evicted by another thread while the
+  // caller deserializes it.
+  int length = static_cast<int>(it->data.size());
+  byte* copy = NewArray<byte>(length);
+  CopyBytes(copy, it->data.data(), length);
+  ScriptData* result = new ScriptData(copy, length);
+  result->AcquireDataOwnership();
+  return result;
+}
+
+
+void SharedCompilationCache::Put(Handle<String> source,
+                                 const ScriptData* cached_data) {
+  size_t max_size = static_cast<size_t>(FLAG_shared_compilation_cache_size) *
+                    static_cast<size_t>(KB);
+  size_t source_size = static_cast<size_t>(source->length()) *
+                       (source->IsOneByteRepresentation() ? 1 : sizeof(uc16));
+  if (source_size + static_cast<size_t>(cached_data->length()) > max_size) {
+    return;
+  }
+  uint32_t hash = SerializedCodeData::SourceContentHash(source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent();
+  Vector<const byte> chars = RawCharacters(content);
+  Entry entry;
+  entry.hash = hash;
+  entry.is_one_byte = content.IsOneByte();
+  entry.source.assign(chars.start(), chars.start() + chars.length());
+  entry.data.assign(cached_data->data(),
+                    cached_data->data() + cached_data->length());
+
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  EntryTable::iterator slot = Find(hash, content);
+  if (slot != table_.end()) Erase(slot);
+  EvictUntil(max_size - entry.size());
+  size_ += entry.size();
+  entries_.push_front(std::move(entry));
+  table_.insert(std::make_pair(hash, entries_.begin()));
+}
+
+
+void SharedCompilationCache::Remove(Handle<String> source) {
+  if (IsEmpty()) return;
+  uint32_t hash = SerializedCodeData::SourceContentHash(source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent();
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  EntryTable::iterator slot = Find(hash, content);
+  if (slot != table_.end()) Erase(slot);
+}
+
+
+void SharedCompilationCache::Clear() {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  table_.clear();
+  entries_.clear();
+  size_ = 0;
+}
+
+
+int SharedCompilationCache::length() const {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  return static_cast<int>(entries_.size());
+}
+
+
+size_t SharedCompilationCache::size() const {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  return size_;
+}
+
+
+bool SharedCompilationCache::IsEmpty() const {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  return entries_.empty();
+}
+
+
+SharedCompilationCache::EntryTable::iterator SharedCompilationCache::Find(
+    uint32_t hash, const String::FlatContent& content) {
+  Vector<const byte> chars = RawCharacters(content);
+  bool is_one_byte = content.IsOneByte();
+  auto range = table_.equal_range(hash);
+  for (EntryTable::iterator slot = range.first; slot != range.second;
+       ++slot) {
+    const Entry& entry = *slot->second;
+    if (entry.is_one_byte == is_one_byte &&
+        entry.source.size() == static_cast<size_t>(chars.length()) &&
+        memcmp(entry.source.data(), chars.start(), chars.length()) == 0) {
+      return slot;
+    }
+  }
+  return table_.end();
+}
+
+
+void SharedCompilationCache::Erase(EntryTable::iterator slot) {
+  EntryList::iterator it = slot->second;
+  size_ -= it->size();
+  table_.erase(slot);
+  entries_.erase(it);
+}
+
+
+void SharedCompilationCache::EvictUntil(size_t max_size) {
+  while (size_ > max_size) {
+    DCHECK(!entries_.empty());
+    EntryList::iterator last = std::prev(entries_.end());
+    auto range = table_.equal_range(last->hash);
+    EntryTable::iterator slot = range.first;
+    while (slot->second != last) {
+      ++slot;
+      DCHECK(slot != range.second);
+    }
+    Erase(slot);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
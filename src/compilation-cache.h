@@ -5,13 +5,20 @@
 #ifndef V8_COMPILATION_CACHE_H_
 #define V8_COMPILATION_CACHE_H_
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+
 #include "src/allocation.h"
+#include "src/base/platform/mutex.h"
 #include "src/handles.h"
 #include "src/objects.h"
 
 namespace v8 {
 namespace internal {
 
+class ScriptData;
+
 // The compilation cache consists of several generational sub-caches which uses
 // this class as a base class. A sub-cache contains a compilation cache tables
 // for each generation of the sub-cache. Since the same source code string has
@@ -21,7 +28,11 @@ class CompilationSubCache {
  public:
   CompilationSubCache(Isolate* isolate, int generations)
       : isolate_(isolate),
-        generations_(generations) {
+        generations_(generations),
+        hits_(0),
+        misses_(0),
+        evictions_(0),
+        size_(0) {
     tables_ = NewArray<Object*>(generations);
   }
 
@@ -59,13 +70,49 @@ class CompilationSubCache {
   // Number of generations in this sub-cache.
   inline int generations() { return generations_; }
 
+  // Statistics since the isolate was created.
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+  size_t evictions() const { return evictions_; }
+
+  // Estimated number of bytes retained by the entries of this sub-cache.
+  size_t size();
+
  protected:
   Isolate* isolate() { return isolate_; }
 
+  void RecordHit();
+  void RecordMiss();
+
+  // Only used if the sub-cache is bounded by --compilation_cache_size. Records
+  // that the first generation entry with the given hash and value was added
+  // or used, and evicts the least recently used entries over the budget.
+  void RecordUse(uint32_t hash, Handle<Object> value, Handle<String> source);
+
  private:
+  // An entry of a bounded sub-cache, identified by its hash and value.
+  struct Use {
+    Object* value;
+    uint32_t hash;
+    size_t cost;
+  };
+  // Most recently used entries come first.
+  typedef std::list<Use> UseList;
+  // Uses keyed by hash, since values move during GC.
+  typedef std::unordered_multimap<uint32_t, UseList::iterator> UseTable;
+
+  void EvictUntil(size_t max_size);
+  void EraseUse(UseTable::iterator slot);
+
   Isolate* isolate_;
   int generations_;  // Number of generations.
   Object** tables_;  // Compilation cache tables - one for each generation.
+  size_t hits_;
+  size_t misses_;
+  size_t evictions_;
+  UseList uses_;
+  UseTable use_table_;
+  size_t size_;  // Total cost of uses_.
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationSubCache);
 };
@@ -206,15 +253,22 @@ class CompilationCache {
   void Enable();
   void Disable();
 
+  // The number of sub caches covering the different types to cache.
+  static const int kSubCacheCount = 4;
+
+  // Access to the sub caches for statistics.
+  static const char* SubCacheName(int index);
+  CompilationSubCache* sub_cache(int index) {
+    DCHECK(0 <= index && index < kSubCacheCount);
+    return subcaches_[index];
+  }
+
  private:
   explicit CompilationCache(Isolate* isolate);
   ~CompilationCache();
 
   base::HashMap* EagerOptimizingSet();
 
-  // The number of sub caches covering the different types to cache.
-  static const int kSubCacheCount = 4;
-
   bool IsEnabled() { return FLAG_compilation_cache && enabled_; }
 
   Isolate* isolate() { return isolate_; }
@@ -236,6 +290,71 @@ class CompilationCache {
 };
 
 
+// The shared compilation cache keeps compiled top-level scripts for all
+// isolates in the process. Entries are code caches in the CodeSerializer
+// format, which do not refer to any particular isolate or context, and are
+// looked up using the source string as the key. The total size is bounded by
+// --shared_compilation_cache_size; the least recently used entries are
+// evicted first. All methods are thread-safe.
+class SharedCompilationCache {
+ public:
+  SharedCompilationCache();
+
+  // Returns the process-wide instance.
+  static SharedCompilationCache* Get();
+
+  // Returns a copy of the code cache for the given source string, or nullptr
+  // if there is none. The caller takes ownership of the result.
+  ScriptData* Lookup(Handle<String> source);
+
+  // Associate the source string with a copy of the given code cache. This may
+  // overwrite an existing mapping.
+  void Put(Handle<String> source, const ScriptData* cached_data);
+
+  // Remove the entry for the given source string, e.g. because its code cache
+  // got rejected.
+  void Remove(Handle<String> source);
+
+  // Clear the cache evicting all its content.
+  void Clear();
+
+  // Number of entries and number of bytes held by the cache.
+  int length() const;
+  size_t size() const;
+
+ private:
+  struct Entry {
+    size_t size() const { return source.size() + data.size(); }
+
+    uint32_t hash;
+    bool is_one_byte;
+    std::vector<byte> source;  // Raw characters of the flat source string.
+    std::vector<byte> data;
+  };
+  // Most recently used entries come first.
+  typedef std::list<Entry> EntryList;
+  // Entries keyed by the content hash of their source.
+  typedef std::unordered_multimap<uint32_t, EntryList::iterator> EntryTable;
+
+  // Returns true if there are no entries, so that callers can skip hashing
+  // the source.
+  bool IsEmpty() const;
+
+  // Returns the table slot of the entry for the given source, or
+  // table_.end(). Must be called with the mutex held.
+  EntryTable::iterator Find(uint32_t hash, const String::FlatContent& content);
+  // Removes an entry. Must be called with the mutex held.
+  void Erase(EntryTable::iterator slot);
+  void EvictUntil(size_t max_size);
+
+  mutable base::Mutex mutex_;
+  EntryList entries_;
+  EntryTable table_;
+  size_t size_;
+
+  DISALLOW_COPY_AND_ASSIGN(SharedCompilationCache);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -44,6 +44,17 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
 }
 
 
+void FunctionCompilationStatistics::RecordPhaseStats(
+    const char* phase_name, const CompilationStatistics::BasicStats& stats) {
+  PhaseStats phase_stats = {phase_name, stats.delta_,
+                            stats.max_allocated_bytes_};
+  phases_.push_back(phase_stats);
+  if (stats.absolute_max_allocated_bytes_ > max_allocated_bytes_) {
+    max_allocated_bytes_ = stats.absolute_max_allocated_bytes_;
+  }
+}
+
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
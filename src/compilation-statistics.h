@@ -7,6 +7,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/platform/time.h"
@@ -86,6 +87,34 @@ class CompilationStatistics final : public Malloced {
 
 std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& s);
 
+// Phase statistics of a single compilation job. Unlike CompilationStatistics,
+// which aggregates over all compilations of an isolate, these are owned by
+// the CompilationInfo of the job and reported once the job has finished.
+class FunctionCompilationStatistics final : public Malloced {
+ public:
+  struct PhaseStats {
+    const char* phase_name;
+    base::TimeDelta delta;
+    size_t max_allocated_bytes;
+  };
+
+  FunctionCompilationStatistics() : max_allocated_bytes_(0) {}
+
+  void RecordPhaseStats(const char* phase_name,
+                        const CompilationStatistics::BasicStats& stats);
+
+  const std::vector<PhaseStats>& phases() const { return phases_; }
+
+  // Peak zone memory used by the recorded phases.
+  size_t max_allocated_bytes() const { return max_allocated_bytes_; }
+
+ private:
+  std::vector<PhaseStats> phases_;
+  size_t max_allocated_bytes_;
+
+  DISALLOW_COPY_AND_ASSIGN(FunctionCompilationStatistics);
+};
+
 }  // namespace internal
 }  // namespace v8
 
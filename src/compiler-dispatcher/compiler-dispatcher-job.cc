@@ -26,6 +26,9 @@ CompilerDispatcherJob::CompilerDispatcherJob(Isolate* isolate,
           isolate_->global_handles()->Create(*function))),
       max_stack_size_(max_stack_size),
       can_compile_on_background_thread_(false) {
+  // The job must not keep a function alive that is never going to be called.
+  // The handle is reset to null when the function dies.
+  GlobalHandles::MakeWeak(reinterpret_cast<Object***>(&function_));
   HandleScope scope(isolate_);
   Handle<SharedFunctionInfo> shared(function_->shared(), isolate_);
   Handle<Script> script(Script::cast(shared->script()), isolate_);
@@ -38,7 +41,9 @@ CompilerDispatcherJob::~CompilerDispatcherJob() {
   DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
   DCHECK(status_ == CompileJobStatus::kInitial ||
          status_ == CompileJobStatus::kDone);
-  i::GlobalHandles::Destroy(Handle<Object>::cast(function_).location());
+  if (!function_.is_null()) {
+    i::GlobalHandles::Destroy(Handle<Object>::cast(function_).location());
+  }
 }
 
 void CompilerDispatcherJob::PrepareToParseOnMainThread() {
@@ -124,6 +129,7 @@ void CompilerDispatcherJob::Parse() {
 bool CompilerDispatcherJob::FinalizeParsingOnMainThread() {
   DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
   DCHECK(status() == CompileJobStatus::kParsed);
+  DCHECK(!function_.is_null());
 
   if (!source_.is_null()) {
     i::GlobalHandles::Destroy(Handle<Object>::cast(source_).location());
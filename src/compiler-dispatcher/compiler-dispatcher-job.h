@@ -43,6 +43,8 @@ class CompilerDispatcherJob {
   ~CompilerDispatcherJob();
 
   CompileJobStatus status() const { return status_; }
+  // Returns a null handle once the function has been garbage collected.
+  Handle<JSFunction> function() const { return function_; }
   bool can_parse_on_background_thread() const {
     return can_parse_on_background_thread_;
   }
@@ -81,7 +83,7 @@ class CompilerDispatcherJob {
 
   CompileJobStatus status_ = CompileJobStatus::kInitial;
   Isolate* isolate_;
-  Handle<JSFunction> function_;  // Global handle.
+  Handle<JSFunction> function_;  // Weak global handle.
   Handle<String> source_;        // Global handle.
   size_t max_stack_size_;
 
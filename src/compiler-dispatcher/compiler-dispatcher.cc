@@ -0,0 +1,182 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
+
+#include "include/v8-platform.h"
+#include "src/base/platform/semaphore.h"
+#include "src/compiler-dispatcher/compiler-dispatcher-job.h"
+#include "src/flags.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+struct CompilerDispatcher::Entry {
+  Entry(CompilerDispatcherJob* job, uint64_t id)
+      : job(job), id(id), parsing_done(0), parsed(false) {}
+
+  std::unique_ptr<CompilerDispatcherJob> job;
+  uint64_t id;
+  // Signaled by the ParseTask once the background parse is done. The main
+  // thread must not touch |job| before waiting on it.
+  base::Semaphore parsing_done;
+  bool parsed;
+};
+
+class CompilerDispatcher::ParseTask : public v8::Task {
+ public:
+  explicit ParseTask(Entry* entry) : entry_(entry) {}
+
+  void Run() override {
+    entry_->job->Parse();
+    entry_->parsing_done.Signal();
+  }
+
+ private:
+  Entry* entry_;  // Not owned.
+
+  DISALLOW_COPY_AND_ASSIGN(ParseTask);
+};
+
+CompilerDispatcher::CompilerDispatcher(Isolate* isolate, size_t max_stack_size)
+    : isolate_(isolate), max_stack_size_(max_stack_size), next_job_id_(0) {}
+
+CompilerDispatcher::~CompilerDispatcher() { AbortAll(); }
+
+bool CompilerDispatcher::Enqueue(Handle<JSFunction> function) {
+  DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
+  if (FLAG_compiler_dispatcher_max_jobs <= 0) return false;
+  SharedFunctionInfo* shared = function->shared();
+  if (shared->is_compiled() || !shared->script()->IsScript()) return false;
+  if (Script::cast(shared->script())->type() == Script::TYPE_NATIVE) {
+    return false;
+  }
+  JobMap::const_iterator it = GetEntryFor(shared);
+  if (it != jobs_.end()) {
+    if (!it->second->job->function().is_null()) return false;
+    // The job belongs to a closure that died, replace it.
+    AbortEntry(it);
+  }
+
+  std::unique_ptr<CompilerDispatcherJob> job(
+      new CompilerDispatcherJob(isolate_, function, max_stack_size_));
+  // Only functions whose source lives outside of the heap can be parsed
+  // concurrently with the main thread.
+  if (!job->can_parse_on_background_thread()) return false;
+  MakeRoomForJob();
+  job->PrepareToParseOnMainThread();
+
+  if (FLAG_trace_compiler_dispatcher) {
+    PrintF("[compiler dispatcher: enqueued ");
+    function->ShortPrint();
+    PrintF("]\n");
+  }
+
+  Entry* entry = new Entry(job.release(), next_job_id_++);
+  jobs_[KeyFor(shared)] = std::unique_ptr<Entry>(entry);
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new ParseTask(entry), v8::Platform::kShortRunningTask);
+  return true;
+}
+
+bool CompilerDispatcher::IsEnqueued(Handle<SharedFunctionInfo> function) const {
+  JobMap::const_iterator it = GetEntryFor(*function);
+  return it != jobs_.end() && !it->second->job->function().is_null();
+}
+
+bool CompilerDispatcher::FinishNow(Handle<JSFunction> function) {
+  DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
+  JobMap::iterator it = jobs_.find(KeyFor(function->shared()));
+  DCHECK(it != jobs_.end());
+  std::unique_ptr<Entry> entry = std::move(it->second);
+  jobs_.erase(it);
+  WaitForParsing(entry.get());
+
+  if (FLAG_trace_compiler_dispatcher) {
+    PrintF("[compiler dispatcher: finishing ");
+    function->ShortPrint();
+    PrintF("]\n");
+  }
+
+  CompilerDispatcherJob* job = entry->job.get();
+  DCHECK(!job->function().is_null());
+  if (function->shared()->is_compiled()) {
+    // Something else compiled the function in the meantime; the parse result
+    // is no longer needed.
+    job->ResetOnMainThread();
+    return true;
+  }
+  if (job->FinalizeParsingOnMainThread() &&
+      job->PrepareToCompileOnMainThread()) {
+    job->Compile();
+    if (job->FinalizeCompilingOnMainThread()) return true;
+  }
+  job->ResetOnMainThread();
+  return false;
+}
+
+void CompilerDispatcher::AbortAll() {
+  DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
+  for (auto& job : jobs_) {
+    WaitForParsing(job.second.get());
+    job.second->job->ResetOnMainThread();
+  }
+  jobs_.clear();
+}
+
+// static
+CompilerDispatcher::JobKey CompilerDispatcher::KeyFor(
+    SharedFunctionInfo* shared) {
+  return JobKey(Script::cast(shared->script())->id(),
+                shared->start_position());
+}
+
+CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::GetEntryFor(
+    SharedFunctionInfo* shared) const {
+  if (!shared->script()->IsScript()) return jobs_.end();
+  return jobs_.find(KeyFor(shared));
+}
+
+void CompilerDispatcher::AbortEntry(JobMap::const_iterator it) {
+  WaitForParsing(it->second.get());
+  it->second->job->ResetOnMainThread();
+  jobs_.erase(it);
+}
+
+void CompilerDispatcher::MakeRoomForJob() {
+  if (jobs_.size() < static_cast<size_t>(FLAG_compiler_dispatcher_max_jobs)) {
+    return;
+  }
+  // Drop the jobs of functions that died first, then the oldest job.
+  for (JobMap::const_iterator it = jobs_.begin(); it != jobs_.end();) {
+    if (it->second->job->function().is_null()) {
+      AbortEntry(it++);
+    } else {
+      ++it;
+    }
+  }
+  if (jobs_.size() < static_cast<size_t>(FLAG_compiler_dispatcher_max_jobs)) {
+    return;
+  }
+  JobMap::const_iterator oldest = jobs_.begin();
+  for (JobMap::const_iterator it = jobs_.begin(); it != jobs_.end(); ++it) {
+    if (it->second->id < oldest->second->id) oldest = it;
+  }
+  if (FLAG_trace_compiler_dispatcher) {
+    PrintF("[compiler dispatcher: too many jobs, aborting oldest]\n");
+  }
+  AbortEntry(oldest);
+}
+
+void CompilerDispatcher::WaitForParsing(Entry* entry) {
+  if (entry->parsed) return;
+  entry->parsing_done.Wait();
+  entry->parsed = true;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,83 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
+#define V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+#include "src/base/functional.h"
+#include "src/base/macros.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class CompilerDispatcherJob;
+class Isolate;
+class JSFunction;
+class SharedFunctionInfo;
+
+// The CompilerDispatcher parses the bodies of lazily compiled functions on
+// background threads ahead of their first invocation. Each function is parsed
+// into its own Zone by a CompilerDispatcherJob; when the function is called,
+// the lazy compile path finishes the job on the main thread instead of
+// re-parsing the function from scratch.
+//
+// Jobs only hold their function weakly. Jobs of functions that died are
+// dropped, and all jobs are aborted under memory pressure.
+//
+// All methods must be called on the main thread of the isolate.
+class CompilerDispatcher {
+ public:
+  CompilerDispatcher(Isolate* isolate, size_t max_stack_size);
+  ~CompilerDispatcher();
+
+  // Returns true if a job was enqueued. If --compiler-dispatcher-max-jobs
+  // jobs are pending already, the oldest one is aborted to make room.
+  bool Enqueue(Handle<JSFunction> function);
+
+  // Returns true if there is a pending job for the given function.
+  bool IsEnqueued(Handle<SharedFunctionInfo> function) const;
+
+  // Blocks until the given function is parsed and then compiles it on the
+  // main thread. Returns false (with a pending exception) if compilation
+  // failed.
+  bool FinishNow(Handle<JSFunction> function);
+
+  // Aborts all jobs, blocking until all background parse tasks are done.
+  void AbortAll();
+
+ private:
+  class ParseTask;
+  struct Entry;
+
+  // Jobs are keyed by the script id and start position of their function.
+  // Unlike the address of the SharedFunctionInfo, those don't change on GC.
+  typedef std::pair<int, int> JobKey;
+  typedef std::unordered_map<JobKey, std::unique_ptr<Entry>,
+                             base::hash<JobKey>>
+      JobMap;
+
+  static JobKey KeyFor(SharedFunctionInfo* shared);
+  JobMap::const_iterator GetEntryFor(SharedFunctionInfo* shared) const;
+  void AbortEntry(JobMap::const_iterator it);
+  void MakeRoomForJob();
+  void WaitForParsing(Entry* entry);
+
+  Isolate* isolate_;
+  size_t max_stack_size_;
+  JobMap jobs_;
+  // Enqueue order of the jobs, used to pick the job to abort when full.
+  uint64_t next_job_id_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompilerDispatcher);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
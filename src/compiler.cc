@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <sstream>
 
 #include "src/asmjs/asm-js.h"
 #include "src/asmjs/asm-typer.h"
@@ -15,6 +16,8 @@
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
+#include "src/compilation-statistics.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/compiler/pipeline.h"
 #include "src/crankshaft/hydrogen.h"
@@ -34,6 +37,7 @@
 #include "src/parsing/scanner-character-streams.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/tracing/trace-event.h"
 #include "src/vm-state-inl.h"
 
 namespace v8 {
@@ -90,6 +94,26 @@ struct ScopedTimer {
   base::TimeDelta* location_;
 };
 
+namespace {
+
+bool IsFunctionCompilationTracingEnabled() {
+  bool tracing_enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                                     &tracing_enabled);
+  return tracing_enabled;
+}
+
+// Writes {string} to {os} as a quoted and escaped JSON string.
+void PrintJSONString(std::ostream& os, String* string) {
+  DisallowHeapAllocation no_gc;
+  os << "\"";
+  StringCharacterStream stream(string);
+  while (stream.HasMore()) os << AsEscapedUC16ForJSON(stream.GetNext());
+  os << "\"";
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------------
 // Implementation of CompilationInfo
 
@@ -142,7 +166,13 @@ CompilationInfo::CompilationInfo(ParseInfo* parse_info,
       parameter_count_(0),
       optimization_id_(-1),
       osr_expr_stack_height_(0),
-      debug_name_(debug_name) {}
+      debug_name_(debug_name) {
+  if (mode != STUB &&
+      (isolate->function_compilation_event_handler() != nullptr ||
+       IsFunctionCompilationTracingEnabled())) {
+    function_statistics_.reset(new FunctionCompilationStatistics());
+  }
+}
 
 CompilationInfo::~CompilationInfo() {
   if (GetFlag(kDisableFutureOptimization) && has_shared_info()) {
@@ -234,6 +264,22 @@ CompilationInfo::SourcePositionRecordingMode() const {
              : SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
 }
 
+SourcePositionTableBuilder::RecordingMode
+CompilationInfo::BytecodeSourcePositionRecordingMode() const {
+  // Positions of top-level code are needed right away for most errors, and
+  // without a debugger or profiler attached nobody looks at those of inner
+  // functions until an exception is thrown.
+  if (FLAG_lazy_source_positions && !is_collecting_source_positions() &&
+      !is_debug() && has_shared_info() && !shared_info()->is_toplevel() &&
+      shared_info()->IsSubjectToDebugging() &&
+      !isolate()->debug()->is_active() &&
+      !isolate()->logger()->is_logging_code_events() &&
+      !isolate()->is_profiling()) {
+    return SourcePositionTableBuilder::OMIT_SOURCE_POSITIONS;
+  }
+  return SourcePositionRecordingMode();
+}
+
 bool CompilationInfo::ExpectsJSReceiverAsReceiver() {
   return is_sloppy(parse_info()->language_mode()) && !parse_info()->is_native();
 }
@@ -304,7 +350,7 @@ void CompilationJob::RecordUnoptimizedCompilationStats() const {
   counters->total_baseline_code_size()->Increment(code_size);
   counters->total_baseline_compile_count()->Increment(1);
 
-  // TODO(5203): Add timers for each phase of compilation.
+  ReportFunctionCompilationStats(code_size);
 }
 
 void CompilationJob::RecordOptimizedCompilationStats() const {
@@ -340,6 +386,102 @@ void CompilationJob::RecordOptimizedCompilationStats() const {
                                                     time_taken_to_execute_,
                                                     time_taken_to_finalize_);
   }
+  ReportFunctionCompilationStats(info()->code()->SizeIncludingMetadata());
+}
+
+void CompilationJob::ReportFunctionCompilationStats(int code_size) const {
+  FunctionCompilationStatistics* stats = info()->function_statistics();
+  if (stats == nullptr || !info()->has_shared_info()) return;
+  v8::FunctionCompilationEventHandler handler =
+      isolate()->function_compilation_event_handler();
+  bool tracing_enabled = IsFunctionCompilationTracingEnabled();
+  if (handler == nullptr && !tracing_enabled) return;
+
+  Handle<SharedFunctionInfo> shared = info()->shared_info();
+  std::unique_ptr<char[]> name = shared->DebugName()->ToCString();
+  int script_id =
+      shared->script()->IsScript() ? Script::cast(shared->script())->id() : -1;
+  size_t max_allocated_bytes =
+      Max(stats->max_allocated_bytes(), info()->zone()->allocation_size());
+
+  std::vector<std::unique_ptr<char[]>> inlined_names;
+  for (const CompilationInfo::InlinedFunctionHolder& inlined :
+       info()->inlined_functions()) {
+    inlined_names.push_back(inlined.shared_info->DebugName()->ToCString());
+  }
+
+  if (tracing_enabled) {
+    std::ostringstream data;
+    data << "{\"compiler\":\"" << compiler_name_
+         << "\",\"osr\":" << (info()->is_osr() ? "true" : "false")
+         << ",\"script_id\":" << script_id
+         << ",\"prepare_ms\":" << time_taken_to_prepare_.InMillisecondsF()
+         << ",\"execute_ms\":" << time_taken_to_execute_.InMillisecondsF()
+         << ",\"finalize_ms\":" << time_taken_to_finalize_.InMillisecondsF()
+         << ",\"max_allocated_bytes\":" << max_allocated_bytes
+         << ",\"code_size\":" << code_size << ",\"phases\":[";
+    bool first = true;
+    for (const FunctionCompilationStatistics::PhaseStats& phase :
+         stats->phases()) {
+      if (!first) data << ",";
+      first = false;
+      data << "{\"name\":\"" << phase.phase_name
+           << "\",\"ms\":" << phase.delta.InMillisecondsF()
+           << ",\"max_allocated_bytes\":" << phase.max_allocated_bytes << "}";
+    }
+    data << "],\"inlined\":[";
+    first = true;
+    for (const CompilationInfo::InlinedFunctionHolder& inlined :
+         info()->inlined_functions()) {
+      if (!first) data << ",";
+      first = false;
+      PrintJSONString(data, inlined.shared_info->DebugName());
+    }
+    data << "]}";
+    std::string data_string = data.str();
+    TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                         "V8.FunctionCompilationStatistics",
+                         TRACE_EVENT_SCOPE_THREAD, "function",
+                         TRACE_STR_COPY(name.get()), "data",
+                         TRACE_STR_COPY(data_string.c_str()));
+  }
+
+  if (handler != nullptr) {
+    std::vector<v8::FunctionCompilationEvent::Phase> phases;
+    for (const FunctionCompilationStatistics::PhaseStats& phase :
+         stats->phases()) {
+      v8::FunctionCompilationEvent::Phase event_phase;
+      event_phase.name = phase.phase_name;
+      event_phase.time_ms = phase.delta.InMillisecondsF();
+      event_phase.max_allocated_bytes = phase.max_allocated_bytes;
+      phases.push_back(event_phase);
+    }
+    std::vector<v8::FunctionCompilationEvent::name_t> inlined_functions;
+    for (const std::unique_ptr<char[]>& inlined_name : inlined_names) {
+      v8::FunctionCompilationEvent::name_t event_name;
+      event_name.str = inlined_name.get();
+      event_name.len = strlen(inlined_name.get());
+      inlined_functions.push_back(event_name);
+    }
+
+    v8::FunctionCompilationEvent event;
+    event.name.str = name.get();
+    event.name.len = strlen(name.get());
+    event.script_id = script_id;
+    event.compiler = compiler_name_;
+    event.is_osr = info()->is_osr();
+    event.prepare_time_ms = time_taken_to_prepare_.InMillisecondsF();
+    event.execute_time_ms = time_taken_to_execute_.InMillisecondsF();
+    event.finalize_time_ms = time_taken_to_finalize_.InMillisecondsF();
+    event.max_allocated_bytes = max_allocated_bytes;
+    event.code_size = static_cast<size_t>(code_size);
+    event.phases = phases.empty() ? nullptr : &phases[0];
+    event.phase_count = phases.size();
+    event.inlined_functions =
+        inlined_functions.empty() ? nullptr : &inlined_functions[0];
+    event.inlined_function_count = inlined_functions.size();
+    handler(reinterpret_cast<v8::Isolate*>(isolate()), &event);
+  }
 }
 
 namespace {
@@ -789,9 +931,6 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   DCHECK_IMPLIES(ignition_osr, !osr_ast_id.IsNone());
   DCHECK_IMPLIES(ignition_osr, FLAG_ignition_osr);
 
-  // Flag combination --ignition-osr --no-turbo-from-bytecode is unsupported.
-  if (ignition_osr && !FLAG_turbo_from_bytecode) return MaybeHandle<Code>();
-
   Handle<Code> cached_code;
   // TODO(4764): When compiling for OSR from bytecode, BailoutId might derive
   // from bytecode offset and overlap with actual BailoutId. No lookup!
@@ -845,8 +984,11 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   TRACE_EVENT_RUNTIME_CALL_STATS_TRACING_SCOPED(
       isolate, &tracing::TraceEventStatsTable::OptimizeCode);
 
-  // TurboFan can optimize directly from existing bytecode.
-  if (FLAG_turbo_from_bytecode && use_turbofan && ShouldUseIgnition(info)) {
+  // TurboFan can optimize directly from existing bytecode. On-stack
+  // replacement of an interpreter frame always does so, since its OSR entry
+  // is described by a bytecode offset.
+  if (ignition_osr ||
+      (FLAG_turbo_from_bytecode && use_turbofan && ShouldUseIgnition(info))) {
     if (!Compiler::EnsureBytecode(info)) {
       if (isolate->has_pending_exception()) isolate->clear_pending_exception();
       return MaybeHandle<Code>();
@@ -956,11 +1098,11 @@ class InterpreterActivationsFinder : public ThreadVisitor,
     JavaScriptFrameIterator it(isolate, top);
     for (; !it.done(); it.Advance()) {
       JavaScriptFrame* frame = it.frame();
-      if (FLAG_turbo_from_bytecode && FLAG_ignition_osr &&
-          frame->is_optimized() && frame->function()->shared() == shared_) {
-        // If we are able to optimize functions directly from bytecode, then
-        // there might be optimized OSR code active on the stack that is not
-        // reachable through a function. We count this as an activation.
+      if (FLAG_ignition_osr && frame->is_optimized() &&
+          frame->function()->shared() == shared_) {
+        // If we are able to perform OSR from bytecode, then there might be
+        // optimized OSR code active on the stack that is not reachable
+        // through a function. We count this as an activation.
         has_activations_ = true;
       }
       if (frame->is_interpreted() && frame->function()->shared() == shared_) {
@@ -1143,11 +1285,20 @@ MaybeHandle<Code> GetLazyCode(Handle<JSFunction> function) {
     return entry;
   }
 
-  Zone zone(isolate->allocator());
-  ParseInfo parse_info(&zone, function);
-  CompilationInfo info(&parse_info, function);
   Handle<Code> result;
-  ASSIGN_RETURN_ON_EXCEPTION(isolate, result, GetUnoptimizedCode(&info), Code);
+  // The function may already have been parsed on a background thread.
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (dispatcher->IsEnqueued(handle(function->shared(), isolate))) {
+    if (!dispatcher->FinishNow(function)) return MaybeHandle<Code>();
+    result = handle(function->shared()->code(), isolate);
+  } else {
+    Zone zone(isolate->allocator());
+    ParseInfo parse_info(&zone, function);
+    CompilationInfo info(&parse_info, function);
+    if (parse_info.script()->serializable_code()) info.PrepareForSerializing();
+    ASSIGN_RETURN_ON_EXCEPTION(isolate, result, GetUnoptimizedCode(&info),
+                               Code);
+  }
 
   if (FLAG_always_opt) {
     Handle<Code> opt_code;
@@ -1507,6 +1658,93 @@ bool Compiler::EnsureBytecode(CompilationInfo* info) {
   return true;
 }
 
+namespace {
+
+bool HasOmittedSourcePositions(SharedFunctionInfo* shared) {
+  // Bytecode that is compiled with source positions contains at least the
+  // position of the implicit return, hence an empty table means omitted.
+  return shared->HasBytecodeArray() &&
+         shared->bytecode_array()->source_position_table()->length() == 0 &&
+         !shared->is_toplevel() && shared->IsSubjectToDebugging();
+}
+
+void CollectSourcePositions(ParseInfo* parse_info) {
+  Isolate* isolate = parse_info->isolate();
+  Handle<SharedFunctionInfo> shared = parse_info->shared_info();
+  Handle<BytecodeArray> bytecode(shared->bytecode_array(), isolate);
+  // Positions are collected while an error is constructed, which may well be
+  // a stack overflow. Re-parsing would only overflow again.
+  StackLimitCheck check(isolate);
+  if (check.HasOverflowed()) return;
+  HistogramTimerScope timer(isolate->counters()->collect_source_positions());
+  VMState<COMPILER> state(isolate);
+  PostponeInterruptsScope postpone(isolate);
+  CanonicalHandleScope canonical(isolate);
+
+  CompilationInfo info(parse_info, Handle<JSFunction>::null());
+  info.MarkAsCollectingSourcePositions();
+  // The function compiled before, so failing now can only be due to resource
+  // limits. Those must not surface as exceptions in the caller.
+  parse_info->set_suppress_errors();
+  std::unique_ptr<CompilationJob> job;
+  if (Parser::ParseStatic(parse_info) && Compiler::Analyze(parse_info)) {
+    job.reset(interpreter::Interpreter::NewCompilationJob(&info));
+  }
+  if (!job || job->PrepareJob() != CompilationJob::SUCCEEDED ||
+      job->ExecuteJob() != CompilationJob::SUCCEEDED ||
+      job->FinalizeJob() != CompilationJob::SUCCEEDED) {
+    DCHECK(!isolate->has_pending_exception());
+    return;
+  }
+
+  // The positions are only valid for the existing bytecode if re-generating
+  // it produced the very same bytecode again.
+  Handle<BytecodeArray> collected = info.bytecode_array();
+  if (collected->length() != bytecode->length() ||
+      memcmp(collected->GetFirstBytecodeAddress(),
+             bytecode->GetFirstBytecodeAddress(), bytecode->length()) != 0) {
+    return;
+  }
+  Handle<ByteArray> table(collected->source_position_table(), isolate);
+  bytecode->set_source_position_table(*table);
+  if (shared->HasDebugInfo() &&
+      shared->GetDebugInfo()->HasDebugBytecodeArray()) {
+    shared->GetDebugInfo()->DebugBytecodeArray()->set_source_position_table(
+        *table);
+  }
+  LOG_CODE_EVENT(isolate, CodeLinePosInfoRecordEvent(
+                              AbstractCode::cast(*bytecode), *table));
+
+  Counters* counters = isolate->counters();
+  counters->bytecode_source_positions_collected()->Increment();
+  counters->bytecode_source_position_bytes_collected()->Increment(
+      table->Size());
+}
+
+}  // namespace
+
+void Compiler::EnsureSourcePositions(Handle<JSFunction> function) {
+  Isolate* isolate = function->GetIsolate();
+  if (!HasOmittedSourcePositions(function->shared())) return;
+  if (isolate->has_pending_exception()) return;
+  HandleScope scope(isolate);
+  Zone zone(isolate->allocator());
+  ParseInfo parse_info(&zone, function);
+  CollectSourcePositions(&parse_info);
+}
+
+void Compiler::EnsureSourcePositions(Handle<SharedFunctionInfo> shared) {
+  Isolate* isolate = shared->GetIsolate();
+  if (!HasOmittedSourcePositions(*shared)) return;
+  if (isolate->has_pending_exception()) return;
+  // Without a closure the outer scope chain of the function is not known.
+  if (!shared->allows_lazy_compilation_without_context()) return;
+  HandleScope scope(isolate);
+  Zone zone(isolate->allocator());
+  ParseInfo parse_info(&zone, shared);
+  CollectSourcePositions(&parse_info);
+}
+
 // TODO(turbofan): In the future, unoptimized code with deopt support could
 // be generated lazily once deopt is triggered.
 bool Compiler::EnsureDeoptimizationSupport(CompilationInfo* info) {
@@ -1666,6 +1904,20 @@ bool CodeGenerationFromStringsAllowed(Isolate* isolate,
   }
 }
 
+// Whether a script is looked up in, and added to, the process-wide shared
+// compilation cache.
+bool UseSharedCompilationCache(Isolate* isolate, Handle<String> source,
+                               v8::Extension* extension,
+                               ScriptCompiler::CompileOptions compile_options,
+                               NativesFlag natives, bool is_module) {
+  return FLAG_shared_compilation_cache && FLAG_serialize_toplevel &&
+         FLAG_compilation_cache && extension == NULL &&
+         compile_options == ScriptCompiler::kNoCompileOptions &&
+         natives == NOT_NATIVES_CODE && !is_module &&
+         !isolate->debug()->is_loaded() &&
+         source->length() >= FLAG_shared_compilation_cache_min_source_length;
+}
+
 }  // namespace
 
 MaybeHandle<JSFunction> Compiler::GetFunctionFromString(
@@ -1722,6 +1974,13 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
   CompilationCache* compilation_cache = isolate->compilation_cache();
 
+  // Function entries recorded for, or recovered from, the code cache.
+  ScriptData* preparse_data = nullptr;
+  std::unique_ptr<ScriptData> preparse_data_owner;
+
+  bool use_shared_cache = UseSharedCompilationCache(
+      isolate, source, extension, compile_options, natives, is_module);
+
   // Do a lookup in the compilation cache but not for extensions.
   MaybeHandle<SharedFunctionInfo> maybe_result;
   Handle<SharedFunctionInfo> result;
@@ -1730,8 +1989,34 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     maybe_result = compilation_cache->LookupScript(
         source, script_name, line_offset, column_offset, resource_options,
         context, language_mode);
-    if (maybe_result.is_null() && FLAG_serialize_toplevel &&
-        compile_options == ScriptCompiler::kConsumeCodeCache &&
+    if (maybe_result.is_null() && use_shared_cache) {
+      // Then check the compilation cache shared by all isolates.
+      HistogramTimerScope timer(isolate->counters()->compile_deserialize());
+      RuntimeCallTimerScope runtimeTimer(isolate,
+                                         &RuntimeCallStats::CompileDeserialize);
+      TRACE_EVENT_RUNTIME_CALL_STATS_TRACING_SCOPED(
+          isolate, &tracing::TraceEventStatsTable::CompileDeserialize);
+      SharedCompilationCache* shared_cache = SharedCompilationCache::Get();
+      std::unique_ptr<ScriptData> shared_data(shared_cache->Lookup(source));
+      Handle<SharedFunctionInfo> result;
+      if (shared_data &&
+          CodeSerializer::Deserialize(isolate, shared_data.get(), source)
+              .ToHandle(&result)) {
+        // The script object carries the origin it was first compiled with.
+        Handle<Script> script(Script::cast(result->script()), isolate);
+        Object* undefined = isolate->heap()->undefined_value();
+        script->set_name(script_name.is_null() ? undefined : *script_name);
+        script->set_line_offset(script_name.is_null() ? 0 : line_offset);
+        script->set_column_offset(script_name.is_null() ? 0 : column_offset);
+        script->set_origin_options(resource_options);
+        script->set_source_mapping_url(
+            source_map_url.is_null() ? undefined : *source_map_url);
+        compilation_cache->PutScript(source, context, language_mode, result);
+        return result;
+      }
+      if (shared_data && shared_data->rejected()) shared_cache->Remove(source);
+    } else if (maybe_result.is_null() && FLAG_serialize_toplevel &&
+               compile_options == ScriptCompiler::kConsumeCodeCache &&
         !isolate->debug()->is_loaded()) {
       // Then check cached code provided by embedder.
       HistogramTimerScope timer(isolate->counters()->compile_deserialize());
@@ -1746,7 +2031,14 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
         compilation_cache->PutScript(source, context, language_mode, result);
         return result;
       }
-      // Deserializer failed. Fall through to compile.
+      // Deserializer failed. Fall through to compile, but skip preparsing of
+      // lazy functions if the cached data carries preparse data that still
+      // matches the source.
+      if (FLAG_serialize_preparse_data) {
+        preparse_data =
+            SerializedCodeData::ExtractPreparseData(*cached_data, source);
+        preparse_data_owner.reset(preparse_data);
+      }
     }
   }
 
@@ -1798,11 +2090,26 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     if (FLAG_serialize_toplevel &&
         compile_options == ScriptCompiler::kProduceCodeCache) {
       info.PrepareForSerializing();
+      // Keep lazily compiled functions serializable too, so that a code cache
+      // can still be created once the script has run.
+      script->set_serializable_code(true);
+      if (FLAG_serialize_preparse_data) {
+        parse_info.set_preparse_data(&preparse_data);
+      }
+    } else if (use_shared_cache) {
+      info.PrepareForSerializing();
+    } else if (preparse_data != nullptr) {
+      // Consume the preparse data like a parser cache.
+      parse_info.set_cached_data(&preparse_data);
+      parse_info.set_compile_options(ScriptCompiler::kConsumeParserCache);
     }
 
     parse_info.set_language_mode(
         static_cast<LanguageMode>(parse_info.language_mode() | language_mode));
     result = CompileToplevel(&info);
+    if (compile_options == ScriptCompiler::kProduceCodeCache) {
+      preparse_data_owner.reset(preparse_data);
+    }
     if (extension == NULL && !result.is_null()) {
       compilation_cache->PutScript(source, context, language_mode, result);
       if (FLAG_serialize_toplevel &&
@@ -1813,11 +2120,23 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
                                            &RuntimeCallStats::CompileSerialize);
         TRACE_EVENT_RUNTIME_CALL_STATS_TRACING_SCOPED(
             isolate, &tracing::TraceEventStatsTable::CompileSerialize);
-        *cached_data = CodeSerializer::Serialize(isolate, result, source);
+        *cached_data =
+            CodeSerializer::Serialize(isolate, result, source, preparse_data);
         if (FLAG_profile_deserialization) {
           PrintF("[Compiling and serializing took %0.3f ms]\n",
                  timer.Elapsed().InMillisecondsF());
         }
+      } else if (use_shared_cache) {
+        // Make the script available to other isolates.
+        HistogramTimerScope histogram_timer(
+            isolate->counters()->compile_serialize());
+        RuntimeCallTimerScope runtimeTimer(isolate,
+                                           &RuntimeCallStats::CompileSerialize);
+        TRACE_EVENT_RUNTIME_CALL_STATS_TRACING_SCOPED(
+            isolate, &tracing::TraceEventStatsTable::CompileSerialize);
+        std::unique_ptr<ScriptData> shared_data(
+            CodeSerializer::Serialize(isolate, result, source));
+        SharedCompilationCache::Get()->Put(source, shared_data.get());
       }
     }
 
@@ -2048,8 +2367,19 @@ void Compiler::PostInstantiation(Handle<JSFunction> function,
     DCHECK(shared->is_compiled());
     function->set_literals(cached.literals);
   } else if (shared->is_compiled()) {
-    // TODO(mvstanton): pass pretenure flag to EnsureLiterals.
-    JSFunction::EnsureLiterals(function);
+    if (FLAG_lazy_feedback_allocation && function->code() == shared->code() &&
+        (!shared->feedback_metadata()->is_empty() ||
+         shared->num_literals() > 0)) {
+      // Defer allocation of the literals array and the type feedback vector
+      // until the closure is invoked for the first time. The CompileLazy
+      // builtin installs them together with the shared code, exactly as for
+      // closures created by the FastNewClosureStub.
+      function->ReplaceCode(
+          function->GetIsolate()->builtins()->builtin(Builtins::kCompileLazy));
+    } else {
+      // TODO(mvstanton): pass pretenure flag to EnsureLiterals.
+      JSFunction::EnsureLiterals(function);
+    }
   }
 }
 
@@ -24,6 +24,7 @@ namespace internal {
 // Forward declarations.
 class CompilationInfo;
 class CompilationJob;
+class FunctionCompilationStatistics;
 class JavaScriptFrame;
 class ParseInfo;
 class ScriptData;
@@ -77,6 +78,14 @@ class Compiler : public AllStatic {
   static bool EnsureDeoptimizationSupport(CompilationInfo* info);
   // Ensures that bytecode is generated, calls ParseAndAnalyze internally.
   static bool EnsureBytecode(CompilationInfo* info);
+  // Collects the source position table of the function's bytecode in case it
+  // was omitted at compile time (see --lazy-source-positions). The function is
+  // re-parsed and its bytecode re-generated just for the positions. Failures,
+  // including a lack of stack space, leave the table empty without throwing.
+  static void EnsureSourcePositions(Handle<JSFunction> function);
+  // As above, but only possible if the function can be compiled without a
+  // context. Prefer the variant above whenever a closure is available.
+  static void EnsureSourcePositions(Handle<SharedFunctionInfo> shared);
 
   // The next compilation tier which the function should  be compiled to for
   // optimization. This is used as a hint by the runtime profiler.
@@ -170,6 +179,7 @@ class CompilationInfo final {
     kOptimizeFromBytecode = 1 << 17,
     kTypeFeedbackEnabled = 1 << 18,
     kAccessorInliningEnabled = 1 << 19,
+    kCollectSourcePositions = 1 << 20,
   };
 
   CompilationInfo(ParseInfo* parse_info, Handle<JSFunction> closure);
@@ -292,6 +302,12 @@ class CompilationInfo final {
     return GetFlag(kAccessorInliningEnabled);
   }
 
+  void MarkAsCollectingSourcePositions() { SetFlag(kCollectSourcePositions); }
+
+  bool is_collecting_source_positions() const {
+    return GetFlag(kCollectSourcePositions);
+  }
+
   void MarkAsSourcePositionsEnabled() { SetFlag(kSourcePositionsEnabled); }
 
   bool is_source_positions_enabled() const {
@@ -450,6 +466,12 @@ class CompilationInfo final {
     inlined_functions_.push_back(InlinedFunctionHolder(inlined_function));
   }
 
+  // Per-function phase statistics, or {nullptr} if nobody is interested in
+  // them for this compilation.
+  FunctionCompilationStatistics* function_statistics() const {
+    return function_statistics_.get();
+  }
+
   std::unique_ptr<char[]> GetDebugName() const;
 
   Code::Kind output_code_kind() const {
@@ -462,6 +484,11 @@ class CompilationInfo final {
 
   SourcePositionTableBuilder::RecordingMode SourcePositionRecordingMode() const;
 
+  // Like the above, but may omit source positions of bytecode that can be
+  // collected lazily later on.
+  SourcePositionTableBuilder::RecordingMode
+  BytecodeSourcePositionRecordingMode() const;
+
  private:
   // Compilation mode.
   // BASE is generated by the full codegen, optionally prepared for bailouts.
@@ -526,6 +553,8 @@ class CompilationInfo final {
 
   InlinedFunctionList inlined_functions_;
 
+  std::unique_ptr<FunctionCompilationStatistics> function_statistics_;
+
   // Number of parameters used for compilation of stubs that require arguments.
   int parameter_count_;
 
@@ -621,6 +650,10 @@ class CompilationJob {
   void RegisterWeakObjectsInOptimizedCode(Handle<Code> code);
 
  private:
+  // Reports the statistics of a successful compilation to the embedder and to
+  // the "v8.compile" tracing category.
+  void ReportFunctionCompilationStats(int code_size) const;
+
   CompilationInfo* info_;
   base::TimeDelta time_taken_to_prepare_;
   base::TimeDelta time_taken_to_execute_;
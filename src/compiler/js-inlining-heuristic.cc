@@ -12,6 +12,14 @@ namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Approximate cost of a call in terms of AST nodes of the callee. Inlining
+// a call site saves this overhead for every call.
+const int kCallOverheadInAstNodes = 16;
+
+}  // namespace
+
 Reduction JSInliningHeuristic::Reduce(Node* node) {
   if (!IrOpcode::IsInlineeOpcode(node->opcode())) return NoChange();
 
@@ -100,24 +108,47 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // ---------------------------------------------------------------------------
 
   // In the general case we remember the candidate for later.
-  candidates_.insert({function, node, calls});
+  candidates_.insert({function, node, calls, CandidateScore(function, calls)});
   return NoChange();
 }
 
 
+// static
+double JSInliningHeuristic::CandidateScore(Handle<JSFunction> function,
+                                           int calls) {
+  // Call sites without call count feedback never ran or cannot be judged.
+  if (calls <= 0) return 0.0;
+  // The benefit of a single inlined call is the share of the call's cost
+  // that goes away: almost all of it for tiny callees that are dominated by
+  // the call overhead, little of it for large callees, which also use up
+  // more of the cumulative budget.
+  int const size = function->shared()->ast_node_count();
+  double const benefit = static_cast<double>(kCallOverheadInAstNodes) /
+                         (kCallOverheadInAstNodes + size);
+  return calls * benefit;
+}
+
+
 void JSInliningHeuristic::Finalize() {
   if (candidates_.empty()) return;  // Nothing to do without candidates.
   if (FLAG_trace_turbo_inlining) PrintCandidates();
 
   // We inline at most one candidate in every iteration of the fixpoint.
   // This is to ensure that we don't consume the full inlining budget
-  // on things that aren't called very often.
+  // on things that aren't called very often. Candidates are visited in
+  // order of decreasing score, so the budget goes to the hottest sites.
   // TODO(bmeurer): Use std::priority_queue instead of std::set here.
   while (!candidates_.empty()) {
     if (cumulative_count_ > FLAG_max_inlined_nodes_cumulative) return;
     auto i = candidates_.begin();
     Candidate candidate = *i;
     candidates_.erase(i);
+    // Skip candidates that don't fit into the remaining budget, a smaller
+    // but colder candidate might still fit.
+    if (cumulative_count_ + candidate.function->shared()->ast_node_count() >
+        FLAG_max_inlined_nodes_cumulative) {
+      continue;
+    }
     // Make sure we don't try to inline dead candidate nodes.
     if (!candidate.node->IsDead()) {
       Reduction r = inliner_.ReduceJSCall(candidate.node, candidate.function);
@@ -132,8 +163,8 @@ void JSInliningHeuristic::Finalize() {
 
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
-  if (left.calls != right.calls) {
-    return left.calls > right.calls;
+  if (left.score != right.score) {
+    return left.score > right.score;
   }
   return left.node < right.node;
 }
@@ -142,11 +173,12 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
 void JSInliningHeuristic::PrintCandidates() {
   PrintF("Candidates for inlining (size=%zu):\n", candidates_.size());
   for (const Candidate& candidate : candidates_) {
-    PrintF("  id:%d, calls:%d, size[source]:%d, size[ast]:%d / %s\n",
-           candidate.node->id(), candidate.calls,
-           candidate.function->shared()->SourceSize(),
-           candidate.function->shared()->ast_node_count(),
-           candidate.function->shared()->DebugName()->ToCString().get());
+    PrintF(
+        "  id:%d, calls:%d, score:%.2f, size[source]:%d, size[ast]:%d / %s\n",
+        candidate.node->id(), candidate.calls, candidate.score,
+        candidate.function->shared()->SourceSize(),
+        candidate.function->shared()->ast_node_count(),
+        candidate.function->shared()->DebugName()->ToCString().get());
   }
 }
 
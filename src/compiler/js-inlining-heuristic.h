@@ -34,8 +34,13 @@ class JSInliningHeuristic final : public AdvancedReducer {
     Handle<JSFunction> function;  // The call target being inlined.
     Node* node;                   // The call site at which to inline.
     int calls;                    // Number of times the call site was hit.
+    double score;                 // Expected benefit of inlining the site.
   };
 
+  // Estimates the benefit of inlining {function} at a call site that was
+  // hit {calls} times.
+  static double CandidateScore(Handle<JSFunction> function, int calls);
+
   // Comparator for candidates.
   struct CandidateCompare {
     bool operator()(const Candidate& left, const Candidate& right) const;
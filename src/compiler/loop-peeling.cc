@@ -204,6 +204,56 @@ bool LoopPeeler::CanPeel(LoopTree* loop_tree, LoopTree::Loop* loop) {
 }
 
 
+namespace {
+
+// Checks and loads that load elimination and redundancy elimination know
+// how to remove when they are dominated by an equivalent operation.
+bool IsHoistableOperation(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kCheckBounds:
+    case IrOpcode::kCheckIf:
+    case IrOpcode::kCheckMaps:
+    case IrOpcode::kCheckNumber:
+    case IrOpcode::kCheckString:
+    case IrOpcode::kCheckTaggedPointer:
+    case IrOpcode::kCheckTaggedSigned:
+    case IrOpcode::kCheckedTaggedToFloat64:
+    case IrOpcode::kCheckedTaggedSignedToInt32:
+    case IrOpcode::kCheckedTaggedToInt32:
+    case IrOpcode::kLoadField:
+    case IrOpcode::kLoadElement:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+// static
+bool LoopPeeler::HasLoopInvariantChecks(LoopTree* loop_tree,
+                                        LoopTree::Loop* loop) {
+  for (Node* node : loop_tree->BodyNodes(loop)) {
+    if (!IsHoistableOperation(node)) continue;
+    bool invariant = true;
+    for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+      if (loop_tree->Contains(loop, NodeProperties::GetValueInput(node, i))) {
+        invariant = false;
+        break;
+      }
+    }
+    if (invariant) {
+      if (FLAG_trace_turbo_loop) {
+        PrintF("Loop %i has loop invariant node %i (%s)\n",
+               loop_tree->GetLoopControl(loop)->id(), node->id(),
+               node->op()->mnemonic());
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
 PeeledIteration* LoopPeeler::Peel(Graph* graph, CommonOperatorBuilder* common,
                                   LoopTree* loop_tree, LoopTree::Loop* loop,
                                   Zone* tmp_zone) {
@@ -312,6 +362,9 @@ void PeelInnerLoops(Graph* graph, CommonOperatorBuilder* common,
   }
   // Only peel small-enough loops.
   if (loop->TotalSize() > LoopPeeler::kMaxPeeledNodes) return;
+  // Only peel loops where the peeled iteration pays for itself, i.e. where
+  // it exposes loop invariant checks and loads to later eliminations.
+  if (!LoopPeeler::HasLoopInvariantChecks(loop_tree, loop)) return;
   if (FLAG_trace_turbo_loop) {
     PrintF("Peeling loop with header: ");
     for (Node* node : loop_tree->HeaderNodes(loop)) {
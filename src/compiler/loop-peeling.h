@@ -30,6 +30,11 @@ class CommonOperatorBuilder;
 class LoopPeeler {
  public:
   static bool CanPeel(LoopTree* loop_tree, LoopTree::Loop* loop);
+  // Returns true if the body of {loop} contains checks or loads whose value
+  // inputs are all defined outside of {loop}. Peeling such a loop lets the
+  // copies in the peeled iteration dominate the loop body, so that load
+  // elimination and redundancy elimination can remove the ones in the body.
+  static bool HasLoopInvariantChecks(LoopTree* loop_tree, LoopTree::Loop* loop);
   static PeeledIteration* Peel(Graph* graph, CommonOperatorBuilder* common,
                                LoopTree* loop_tree, LoopTree::Loop* loop,
                                Zone* tmp_zone);
@@ -4,11 +4,16 @@
 
 #include "src/compiler/loop-variable-optimizer.h"
 
+#include "src/compiler/all-nodes.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/node-marker.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/objects-inl.h"
+#include "src/type-cache.h"
 #include "src/zone-containers.h"
 #include "src/zone.h"
 
@@ -245,6 +250,14 @@ void LoopVariableOptimizer::VisitIf(Node* node, bool polarity) {
     case IrOpcode::kJSGreaterThanOrEqual:
       AddCmpToLimits(limits, cond, InductionVariable::kStrict, !polarity);
       break;
+    case IrOpcode::kNumberLessThan:
+    case IrOpcode::kSpeculativeNumberLessThan:
+      AddCmpToLimits(limits, cond, InductionVariable::kStrict, polarity);
+      break;
+    case IrOpcode::kNumberLessThanOrEqual:
+    case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+      AddCmpToLimits(limits, cond, InductionVariable::kNonStrict, polarity);
+      break;
     default:
       break;
   }
@@ -302,13 +315,23 @@ InductionVariable* LoopVariableOptimizer::TryGetInductionVariable(Node* phi) {
   DCHECK_EQ(IrOpcode::kLoop, NodeProperties::GetControlInput(phi)->opcode());
   Node* initial = phi->InputAt(0);
   Node* arith = phi->InputAt(1);
+  // Look through the guards inserted by ChangeToPhisAndInsertGuards, so that
+  // the induction variables can be rediscovered on the lowered graph.
+  if (arith->opcode() == IrOpcode::kTypeGuard) arith = arith->InputAt(0);
   InductionVariable::ArithmeticType arithmeticType;
-  if (arith->opcode() == IrOpcode::kJSAdd) {
-    arithmeticType = InductionVariable::ArithmeticType::kAddition;
-  } else if (arith->opcode() == IrOpcode::kJSSubtract) {
-    arithmeticType = InductionVariable::ArithmeticType::kSubtraction;
-  } else {
-    return nullptr;
+  switch (arith->opcode()) {
+    case IrOpcode::kJSAdd:
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+      arithmeticType = InductionVariable::ArithmeticType::kAddition;
+      break;
+    case IrOpcode::kJSSubtract:
+    case IrOpcode::kNumberSubtract:
+    case IrOpcode::kSpeculativeNumberSubtract:
+      arithmeticType = InductionVariable::ArithmeticType::kSubtraction;
+      break;
+    default:
+      return nullptr;
   }
 
   // TODO(jarin) Support both sides.
@@ -400,6 +423,113 @@ void LoopVariableOptimizer::ChangeToPhisAndInsertGuards() {
   }
 }
 
+namespace {
+
+bool IsFieldLoad(Node* node, int offset) {
+  return node->opcode() == IrOpcode::kLoadField &&
+         FieldAccessOf(node->op()).base_is_tagged == kTaggedBase &&
+         FieldAccessOf(node->op()).offset == offset;
+}
+
+// Typed array element accesses check their index against
+//
+//   Select(NumberEqual(NumberBitwiseAnd(buffer.bit_field, WasNeutered), 0),
+//          array.length, 0)
+//
+// and load the buffer's bit field again for every access, so the length in a
+// loop condition and the one at an access are usually different nodes.
+// Returns the {array.length} load of such a Select, or nullptr for any other
+// node.
+Node* GetNeuteringGuardedLength(Node* node) {
+  if (node->opcode() != IrOpcode::kSelect) return nullptr;
+  Node* check = node->InputAt(0);
+  Node* length = node->InputAt(1);
+  if (!NumberMatcher(node->InputAt(2)).Is(0.0)) return nullptr;
+  if (check->opcode() != IrOpcode::kNumberEqual) return nullptr;
+  if (!NumberMatcher(check->InputAt(1)).Is(0.0)) return nullptr;
+  Node* masked = check->InputAt(0);
+  if (masked->opcode() != IrOpcode::kNumberBitwiseAnd) return nullptr;
+  NumberMatcher mask(masked->InputAt(1));
+  if (!mask.Is(JSArrayBuffer::WasNeutered::kMask)) return nullptr;
+  Node* bit_field = masked->InputAt(0);
+  if (!IsFieldLoad(bit_field, JSArrayBuffer::kBitFieldOffset)) return nullptr;
+  Node* buffer = bit_field->InputAt(0);
+  if (!IsFieldLoad(buffer, JSArrayBufferView::kBufferOffset)) return nullptr;
+  if (!IsFieldLoad(length, JSTypedArray::kLengthOffset)) return nullptr;
+  // The length and the buffer must belong to the same typed array.
+  if (length->InputAt(0) != buffer->InputAt(0)) return nullptr;
+  return length;
+}
+
+// Checks whether {left} and {right} are both neutering guarded lengths of the
+// same typed array. A typed array's length and buffer never change; neutering
+// only marks the buffer, which the Selects check separately.
+bool IsSameTypedArrayLength(Node* left, Node* right) {
+  Node* left_length = GetNeuteringGuardedLength(left);
+  Node* right_length = GetNeuteringGuardedLength(right);
+  if (left_length == nullptr || right_length == nullptr) return false;
+  return left_length == right_length ||
+         left_length->InputAt(0) == right_length->InputAt(0);
+}
+
+}  // namespace
+
+// Returns the length that a loop condition dominating the CheckBounds {node}
+// compared its index against, if that length covers the one being checked.
+Node* LoopVariableOptimizer::FindDominatingLength(Node* node) {
+  DCHECK_EQ(IrOpcode::kCheckBounds, node->opcode());
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* length = NodeProperties::GetValueInput(node, 1);
+  // The index must be a non-negative integer, so that the only thing left to
+  // check is the upper bound.
+  if (!NodeProperties::IsTyped(index) ||
+      !NodeProperties::GetType(index)->Is(TypeCache::Get().kPositiveInteger)) {
+    return nullptr;
+  }
+  Node* control = NodeProperties::GetControlInput(node);
+  if (control->id() >= limits_.size()) return nullptr;
+  const VariableLimits* limits = limits_[control->id()];
+  // Unreachable (or newly created) control nodes have no limits.
+  if (limits == nullptr) return nullptr;
+  for (const Constraint* constraint = limits->head(); constraint != nullptr;
+       constraint = constraint->next()) {
+    if (constraint->kind() == InductionVariable::kStrict &&
+        constraint->left() == index &&
+        (constraint->right() == length ||
+         IsSameTypedArrayLength(constraint->right(), length))) {
+      return constraint->right();
+    }
+  }
+  return nullptr;
+}
+
+void LoopVariableOptimizer::EliminateRedundantBoundsChecks(
+    SimplifiedOperatorBuilder* simplified) {
+  AllNodes all(zone(), graph());
+  for (Node* node : all.reachable) {
+    if (node->opcode() != IrOpcode::kCheckBounds) continue;
+    Node* dominating_length = FindDominatingLength(node);
+    if (dominating_length == nullptr) continue;
+    Node* index = NodeProperties::GetValueInput(node, 0);
+    Node* length = NodeProperties::GetValueInput(node, 1);
+    Node* effect = NodeProperties::GetEffectInput(node);
+    Node* control = NodeProperties::GetControlInput(node);
+    if (dominating_length != length) {
+      // The loop condition only covers the typed array's length, so the
+      // access still has to deoptimize if the buffer was neutered since.
+      Node* check = graph()->NewNode(simplified->CheckIf(), length->InputAt(0),
+                                     effect, control);
+      TRACE("Replacing bounds check %i with neutering check %i\n", node->id(),
+            check->id());
+      effect = check;
+    } else {
+      TRACE("Eliminating redundant bounds check %i\n", node->id());
+    }
+    NodeProperties::ReplaceUses(node, index, effect, control);
+    node->Kill();
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
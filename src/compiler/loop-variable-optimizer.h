@@ -14,6 +14,7 @@ namespace compiler {
 class CommonOperatorBuilder;
 class Graph;
 class Node;
+class SimplifiedOperatorBuilder;
 
 class InductionVariable : public ZoneObject {
  public:
@@ -75,6 +76,13 @@ class LoopVariableOptimizer {
   void ChangeToInductionVariablePhis();
   void ChangeToPhisAndInsertGuards();
 
+  // Removes CheckBounds nodes whose (non-negative) index is known to be
+  // strictly less than the length on every control path reaching the check,
+  // i.e. the checks guarded by a loop condition like {i < a.length}. For
+  // typed arrays only the check for a neutered buffer is kept. Must run after
+  // Run() on a typed graph.
+  void EliminateRedundantBoundsChecks(SimplifiedOperatorBuilder* simplified);
+
  private:
   const int kAssumedLoopEntryIndex = 0;
   const int kFirstBackedge = 1;
@@ -95,6 +103,7 @@ class LoopVariableOptimizer {
                       InductionVariable::ConstraintKind kind, bool polarity);
 
   void TakeConditionsFromFirstControl(Node* node);
+  Node* FindDominatingLength(Node* node);
   const InductionVariable* FindInductionVariable(Node* node);
   InductionVariable* TryGetInductionVariable(Node* phi);
   void DetectInductionVariables(Node* loop);
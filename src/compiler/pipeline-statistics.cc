@@ -48,7 +48,10 @@ PipelineStatistics::PipelineStatistics(CompilationInfo* info,
     : isolate_(info->isolate()),
       outer_zone_(info->zone()),
       zone_pool_(zone_pool),
-      compilation_stats_(isolate_->GetTurboStatistics()),
+      compilation_stats_(FLAG_turbo_stats || FLAG_turbo_stats_nvp
+                             ? isolate_->GetTurboStatistics()
+                             : nullptr),
+      function_stats_(info->function_statistics()),
       source_size_(0),
       phase_kind_name_(nullptr),
       phase_name_(nullptr) {
@@ -66,7 +69,9 @@ PipelineStatistics::~PipelineStatistics() {
   if (InPhaseKind()) EndPhaseKind();
   CompilationStatistics::BasicStats diff;
   total_stats_.End(this, &diff);
-  compilation_stats_->RecordTotalStats(source_size_, diff);
+  if (compilation_stats_ != nullptr) {
+    compilation_stats_->RecordTotalStats(source_size_, diff);
+  }
 }
 
 
@@ -82,7 +87,9 @@ void PipelineStatistics::EndPhaseKind() {
   DCHECK(!InPhase());
   CompilationStatistics::BasicStats diff;
   phase_kind_stats_.End(this, &diff);
-  compilation_stats_->RecordPhaseKindStats(phase_kind_name_, diff);
+  if (compilation_stats_ != nullptr) {
+    compilation_stats_->RecordPhaseKindStats(phase_kind_name_, diff);
+  }
 }
 
 
@@ -97,7 +104,12 @@ void PipelineStatistics::EndPhase() {
   DCHECK(InPhaseKind());
   CompilationStatistics::BasicStats diff;
   phase_stats_.End(this, &diff);
-  compilation_stats_->RecordPhaseStats(phase_kind_name_, phase_name_, diff);
+  if (compilation_stats_ != nullptr) {
+    compilation_stats_->RecordPhaseStats(phase_kind_name_, phase_name_, diff);
+  }
+  if (function_stats_ != nullptr) {
+    function_stats_->RecordPhaseStats(phase_name_, diff);
+  }
 }
 
 }  // namespace compiler
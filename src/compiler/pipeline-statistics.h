@@ -58,7 +58,10 @@ class PipelineStatistics : public Malloced {
   Isolate* isolate_;
   Zone* outer_zone_;
   ZonePool* zone_pool_;
+  // Isolate-wide aggregate, only collected for --turbo-stats.
   CompilationStatistics* compilation_stats_;
+  // Per-function phase breakdown, owned by the CompilationInfo.
+  FunctionCompilationStatistics* function_stats_;
   std::string function_name_;
 
   // Stats for the entire compilation.
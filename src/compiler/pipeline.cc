@@ -287,6 +287,8 @@ class PipelineData {
   void InitializeRegisterAllocationData(const RegisterConfiguration* config,
                                         CallDescriptor* descriptor) {
     DCHECK(register_allocation_data_ == nullptr);
+    register_allocation_zone()->set_kind(
+        base::AccountingAllocator::kRegisterAllocatorZone);
     register_allocation_data_ = new (register_allocation_zone())
         RegisterAllocationData(config, register_allocation_zone(), frame(),
                                sequence(), debug_name_.get());
@@ -526,7 +528,8 @@ PipelineStatistics* CreatePipelineStatistics(CompilationInfo* info,
                                              ZonePool* zone_pool) {
   PipelineStatistics* pipeline_statistics = nullptr;
 
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+      info->function_statistics() != nullptr) {
     pipeline_statistics = new PipelineStatistics(info, zone_pool);
     pipeline_statistics->BeginPhaseKind("initializing");
   }
@@ -570,7 +573,9 @@ class PipelineCompilationJob final : public CompilationJob {
         pipeline_statistics_(CreatePipelineStatistics(info(), &zone_pool_)),
         data_(&zone_pool_, info(), pipeline_statistics_.get()),
         pipeline_(&data_),
-        linkage_(nullptr) {}
+        linkage_(nullptr) {
+    zone_.set_kind(base::AccountingAllocator::kTurboFanZone);
+  }
 
  protected:
   Status PrepareJobImpl() final;
@@ -652,6 +657,10 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl() {
     info()->context()->native_context()->AddOptimizedCode(*code);
     RegisterWeakObjectsInOptimizedCode(code);
   }
+  // The counters are not thread-safe, so the peak zone memory of the
+  // (mostly concurrent) pipeline is only recorded on the main thread.
+  isolate()->counters()->turbofan_peak_zone_memory_bytes()->AddSample(
+      static_cast<int>(zone_pool_.GetMaxAllocatedBytes()));
   return SUCCEEDED;
 }
 
@@ -1123,6 +1132,18 @@ struct LoadEliminationPhase {
   }
 };
 
+struct BoundsCheckEliminationPhase {
+  static const char* phase_name() { return "bounds check elimination"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopVariableOptimizer induction_vars(data->jsgraph()->graph(),
+                                         data->common(), temp_zone);
+    induction_vars.Run();
+    induction_vars.EliminateRedundantBoundsChecks(
+        data->jsgraph()->simplified());
+  }
+};
+
 struct MemoryOptimizationPhase {
   static const char* phase_name() { return "memory optimization"; }
 
@@ -1539,6 +1560,11 @@ bool PipelineImpl::CreateGraph() {
       Run<LoadEliminationPhase>();
       RunPrintAndVerify("Load eliminated");
     }
+
+    if (FLAG_turbo_loop_variable && FLAG_turbo_bounds_check_elimination) {
+      Run<BoundsCheckEliminationPhase>();
+      RunPrintAndVerify("Bounds checks eliminated");
+    }
   }
 
   // Select representations. This has to run w/o the Typer decorator, because
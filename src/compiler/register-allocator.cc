@@ -1804,14 +1804,26 @@ BitVector* LiveRangeBuilder::ComputeLiveOut(const InstructionBlock* block,
     Zone* zone = data->allocation_zone();
     const InstructionSequence* code = data->code();
 
-    live_out = new (zone) BitVector(code->VirtualRegisterCount(), zone);
+    // The live in set of a fall-through successor that has this block as its
+    // only predecessor is not needed once this block is done: control flow
+    // into such a block is resolved eagerly by the LiveRangeConnector, which
+    // never looks at its live in set. Take the set over instead of allocating
+    // one more bit vector per block.
+    for (const RpoNumber& succ : block->successors()) {
+      if (!block->rpo_number().IsNext(succ)) continue;
+      if (code->InstructionBlockAt(succ)->PredecessorCount() != 1) continue;
+      live_out = data->live_in_sets()[succ.ToSize()];
+    }
+    if (live_out == nullptr) {
+      live_out = new (zone) BitVector(code->VirtualRegisterCount(), zone);
+    }
 
     // Process all successor blocks.
     for (const RpoNumber& succ : block->successors()) {
       // Add values live on entry to the successor.
       if (succ <= block->rpo_number()) continue;
       BitVector* live_in = data->live_in_sets()[succ.ToSize()];
-      if (live_in != nullptr) live_out->Union(*live_in);
+      if (live_in != nullptr && live_in != live_out) live_out->Union(*live_in);
 
       // All phi input operands corresponding to this successor edge are live
       // out from this block.
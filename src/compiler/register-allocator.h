@@ -772,6 +772,10 @@ class RegisterAllocationData final : public ZoneObject {
   const ZoneVector<TopLevelLiveRange*>& fixed_double_live_ranges() const {
     return fixed_double_live_ranges_;
   }
+  // The live in sets of blocks whose control flow is resolved eagerly (see
+  // LiveRangeConnector::CanEagerlyResolveControlFlow) are reused as the live
+  // out set of their predecessor, and are meaningless after live range
+  // building.
   ZoneVector<BitVector*>& live_in_sets() { return live_in_sets_; }
   ZoneVector<BitVector*>& live_out_sets() { return live_out_sets_; }
   ZoneVector<SpillRange*>& spill_ranges() { return spill_ranges_; }
@@ -104,6 +104,7 @@ Zone* ZonePool::NewEmptyZone() {
   } else {
     zone = new Zone(allocator_);
   }
+  zone->set_kind(base::AccountingAllocator::kTurboFanZone);
   used_.push_back(zone);
   DCHECK_EQ(0u, zone->allocation_size());
   return zone;
@@ -865,6 +865,8 @@ class RuntimeCallTimerScope {
   /* Compilation times. */                                                     \
   HT(compile, V8.CompileMicroSeconds, 1000000, MICROSECOND)                    \
   HT(compile_eval, V8.CompileEvalMicroSeconds, 1000000, MICROSECOND)           \
+  HT(collect_source_positions, V8.CollectSourcePositionsMicroSeconds, 1000000, \
+     MICROSECOND)                                                              \
   /* Serialization as part of compilation (code caching) */                    \
   HT(compile_serialize, V8.CompileSerializeMicroSeconds, 100000, MICROSECOND)  \
   HT(compile_deserialize, V8.CompileDeserializeMicroSeconds, 1000000,          \
@@ -913,6 +915,8 @@ class RuntimeCallTimerScope {
 #define HISTOGRAM_MEMORY_LIST(HM)                                              \
   HM(memory_heap_committed, V8.MemoryHeapCommitted)                            \
   HM(memory_heap_used, V8.MemoryHeapUsed)                                      \
+  /* TurboFan */                                                               \
+  HM(turbofan_peak_zone_memory_bytes, V8.TurboFanPeakZoneMemoryBytes)          \
   /* Asm/Wasm */                                                               \
   HM(wasm_decode_module_peak_memory_bytes, V8.WasmDecodeModulePeakMemoryBytes) \
   HM(wasm_compile_function_peak_memory_bytes,                                  \
@@ -947,6 +951,7 @@ class RuntimeCallTimerScope {
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  SC(compilation_cache_evictions, V8.CompilationCacheEvictions)       \
   /* Amount of evaled source code. */                                 \
   SC(total_eval_size, V8.TotalEvalSize)                               \
   /* Amount of loaded source code. */                                 \
@@ -976,6 +981,12 @@ class RuntimeCallTimerScope {
   SC(total_stubs_code_size, V8.TotalStubsCodeSize)                             \
   /* Amount of (JS) compiled code. */                                          \
   SC(total_compiled_code_size, V8.TotalCompiledCodeSize)                       \
+  /* Number and size of bytecode arrays flushed from cold functions. */        \
+  SC(bytecode_arrays_flushed, V8.BytecodeArraysFlushed)                        \
+  SC(total_flushed_bytecode_size, V8.TotalFlushedBytecodeSize)                 \
+  /* Number and size of type feedback vectors allocated for closures. */       \
+  SC(feedback_vectors_allocated, V8.FeedbackVectorsAllocated)                  \
+  SC(total_feedback_vector_size, V8.TotalFeedbackVectorSize)                   \
   SC(gc_compactor_caused_by_request, V8.GCCompactorCausedByRequest)            \
   SC(gc_compactor_caused_by_promoted_data, V8.GCCompactorCausedByPromotedData) \
   SC(gc_compactor_caused_by_oldspace_exhaustion,                               \
@@ -1003,8 +1014,14 @@ class RuntimeCallTimerScope {
   SC(negative_lookups, V8.NegativeLookups)                                     \
   SC(negative_lookups_miss, V8.NegativeLookupsMiss)                            \
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
+  SC(megamorphic_stub_cache_secondary_probes,                                  \
+     V8.MegamorphicStubCacheSecondaryProbes)                                   \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_primary_collisions,                                \
+     V8.MegamorphicStubCachePrimaryCollisions)                                 \
+  SC(megamorphic_stub_cache_secondary_collisions,                              \
+     V8.MegamorphicStubCacheSecondaryCollisions)                               \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
@@ -1030,6 +1047,7 @@ class RuntimeCallTimerScope {
   SC(soft_deopts_requested, V8.SoftDeoptsRequested)                            \
   SC(soft_deopts_inserted, V8.SoftDeoptsInserted)                              \
   SC(soft_deopts_executed, V8.SoftDeoptsExecuted)                              \
+  SC(deopt_loops_detected, V8.DeoptLoopsDetected)                              \
   /* Number of write barriers in generated code. */                            \
   SC(write_barriers_dynamic, V8.WriteBarriersDynamic)                          \
   SC(write_barriers_static, V8.WriteBarriersStatic)                            \
@@ -1056,6 +1074,12 @@ class RuntimeCallTimerScope {
   SC(total_baseline_code_size, V8.TotalBaselineCodeSize)                       \
   /* Total count of functions compiled using the baseline compiler. */         \
   SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)               \
+  /* Number of functions compiled to bytecode without source positions. */   \
+  SC(bytecode_source_positions_omitted, V8.BytecodeSourcePositionsOmitted)     \
+  /* Number and total size of source position tables collected lazily. */     \
+  SC(bytecode_source_positions_collected, V8.BytecodeSourcePositionsCollected) \
+  SC(bytecode_source_position_bytes_collected,                                 \
+     V8.BytecodeSourcePositionBytesCollected)                                  \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)
 
@@ -6429,8 +6429,7 @@ bool HOptimizedGraphBuilder::PropertyAccessInfo::CanAccessAsMonomorphic(
     SmallMapList* maps) {
   DCHECK(map_.is_identical_to(maps->first()));
   if (!CanAccessMonomorphic()) return false;
-  STATIC_ASSERT(kMaxLoadPolymorphism == kMaxStorePolymorphism);
-  if (maps->length() > kMaxLoadPolymorphism) return false;
+  if (maps->length() > IC::MaxPolymorphism()) return false;
   HObjectAccess access = HObjectAccess::ForMap();  // bogus default
   if (GetJSObjectFieldAccess(&access)) {
     for (int i = 1; i < maps->length(); ++i) {
@@ -6577,9 +6576,8 @@ void HOptimizedGraphBuilder::HandlePolymorphicNamedFieldAccess(
   bool handled_string = false;
 
   bool handle_smi = false;
-  STATIC_ASSERT(kMaxLoadPolymorphism == kMaxStorePolymorphism);
   int i;
-  for (i = 0; i < maps->length() && count < kMaxLoadPolymorphism; ++i) {
+  for (i = 0; i < maps->length() && count < IC::MaxPolymorphism(); ++i) {
     PropertyAccessInfo info(this, access_type, maps->at(i), name);
     if (info.IsStringType()) {
       if (handled_string) continue;
@@ -6603,7 +6601,7 @@ void HOptimizedGraphBuilder::HandlePolymorphicNamedFieldAccess(
   HControlInstruction* smi_check = NULL;
   handled_string = false;
 
-  for (i = 0; i < maps->length() && count < kMaxLoadPolymorphism; ++i) {
+  for (i = 0; i < maps->length() && count < IC::MaxPolymorphism(); ++i) {
     PropertyAccessInfo info(this, access_type, maps->at(i), name);
     if (info.IsStringType()) {
       if (handled_string) continue;
@@ -8060,7 +8058,7 @@ void HOptimizedGraphBuilder::HandlePolymorphicCallNamed(Call* expr,
                                                         SmallMapList* maps,
                                                         Handle<String> name) {
   int argument_count = expr->arguments()->length() + 1;  // Includes receiver.
-  FunctionSorter order[kMaxCallPolymorphism];
+  FunctionSorter order[kMaxPolymorphicMapCount];
 
   bool handle_smi = false;
   bool handled_string = false;
@@ -8071,8 +8069,8 @@ void HOptimizedGraphBuilder::HandlePolymorphicCallNamed(Call* expr,
       function_state()->ComputeTailCallMode(syntactic_tail_call_mode);
 
   int i;
-  for (i = 0; i < maps->length() && ordered_functions < kMaxCallPolymorphism;
-       ++i) {
+  for (i = 0;
+       i < maps->length() && ordered_functions < IC::MaxPolymorphism(); ++i) {
     PropertyAccessInfo info(this, LOAD, maps->at(i), name);
     if (info.CanAccessMonomorphic() && info.IsDataConstant() &&
         info.constant()->IsJSFunction()) {
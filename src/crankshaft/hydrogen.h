@@ -2156,10 +2156,6 @@ class HOptimizedGraphBuilder : public HGraphBuilder,
   // Forward declarations for inner scope classes.
   class SubgraphScope;
 
-  static const int kMaxCallPolymorphism = 4;
-  static const int kMaxLoadPolymorphism = 4;
-  static const int kMaxStorePolymorphism = 4;
-
   // Even in the 'unlimited' case we have to have some limit in order not to
   // overflow the stack.
   static const int kUnlimitedMaxInlinedSourceSize = 100000;
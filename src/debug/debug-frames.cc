@@ -19,6 +19,15 @@ FrameInspector::FrameInspector(StandardFrame* frame, int inlined_jsframe_index,
   is_bottommost_ = inlined_jsframe_index == 0;
   is_optimized_ = frame_->is_optimized();
   is_interpreted_ = frame_->is_interpreted();
+  // Source positions are computed from the bytecode of the frame's functions,
+  // which might not have collected them yet.
+  if (FLAG_lazy_source_positions && js_frame != nullptr) {
+    List<FrameSummary> summaries(FLAG_max_inlining_levels + 1);
+    js_frame->Summarize(&summaries);
+    for (const FrameSummary& summary : summaries) {
+      summary.EnsureSourcePositions();
+    }
+  }
   // Calculate the deoptimized frame.
   if (frame->is_optimized()) {
     DCHECK(js_frame != nullptr);
@@ -1505,6 +1505,13 @@ bool Debug::EnsureDebugInfo(Handle<SharedFunctionInfo> shared,
     return false;
   }
 
+  // Break locations are found through the source position table.
+  if (function.is_null()) {
+    Compiler::EnsureSourcePositions(shared);
+  } else {
+    Compiler::EnsureSourcePositions(function);
+  }
+
   // To prepare bytecode for debugging, we already need to have the debug
   // info (containing the debug copy) upfront, but since we do not recompile,
   // preparing for break points cannot fail.
@@ -5,6 +5,7 @@
 #include "src/deoptimizer.h"
 
 #include <memory>
+#include <sstream>
 
 #include "src/accessors.h"
 #include "src/ast/prettyprinter.h"
@@ -440,6 +441,28 @@ bool Deoptimizer::TraceEnabledFor(StackFrame::Type frame_type) {
 }
 
 
+namespace {
+
+// Records a deoptimization of {shared}'s optimized code and returns true if
+// the function deoptimized eagerly --deopt-loop-threshold times in a row. The
+// streak is broken by any other kind of deoptimization and by the runtime
+// profiler observing the function's optimized code on the stack.
+bool IsDeoptimizationLoop(SharedFunctionInfo* shared,
+                          Deoptimizer::BailoutType type) {
+  if (type != Deoptimizer::EAGER) {
+    shared->set_deopt_loop_count(0);
+    return false;
+  }
+  shared->increment_deopt_loop_count();
+  if (FLAG_deopt_loop_threshold <= 0) return false;
+  if (shared->optimization_disabled()) return false;
+  int threshold = Min(FLAG_deopt_loop_threshold,
+                      SharedFunctionInfo::DeoptLoopCountBits::kMax);
+  return shared->deopt_loop_count() >= threshold;
+}
+
+}  // namespace
+
 const char* Deoptimizer::MessageFor(BailoutType type) {
   switch (type) {
     case EAGER: return "eager";
@@ -486,6 +509,8 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
   DCHECK(from != nullptr);
   if (function != nullptr && function->IsOptimized()) {
     function->shared()->increment_deopt_count();
+    bool is_deoptimization_loop =
+        IsDeoptimizationLoop(function->shared(), bailout_type_);
     if (bailout_type_ == Deoptimizer::SOFT) {
       isolate->counters()->soft_deopts_executed()->Increment();
       // Soft deopts shouldn't count against the overall re-optimization count
@@ -493,6 +518,11 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
       int opt_count = function->shared()->opt_count();
       if (opt_count > 0) opt_count--;
       function->shared()->set_opt_count(opt_count);
+    } else if (is_deoptimization_loop) {
+      // The function keeps failing the checks of its optimized code. Stop
+      // reoptimizing it, otherwise it bounces between tiers forever.
+      isolate->counters()->deopt_loops_detected()->Increment();
+      function->shared()->DisableOptimization(kDeoptimizationLoop);
     }
   }
   compiled_code_ = FindOptimizedCode(function);
@@ -515,6 +545,7 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
 #endif  // DEBUG
   if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
     PROFILE(isolate_, CodeDeoptEvent(compiled_code_, from_, fp_to_sp_delta_));
+    if (function != nullptr) ReportDeoptimizationEvent(function);
   }
   unsigned size = ComputeInputFrameSize();
   int parameter_count =
@@ -532,6 +563,57 @@ Code* Deoptimizer::FindOptimizedCode(JSFunction* function) {
              : compiled_code;
 }
 
+void Deoptimizer::ReportDeoptimizationEvent(JSFunction* function) {
+  v8::DeoptimizationEventHandler handler =
+      isolate_->deoptimization_event_handler();
+  bool tracing_enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TRACE_DISABLED_BY_DEFAULT("v8.deopt"),
+                                     &tracing_enabled);
+  if (handler == nullptr && !tracing_enabled) return;
+
+  SharedFunctionInfo* shared = function->shared();
+  DeoptInfo info = GetDeoptInfo(compiled_code_, from_);
+  int position = info.position.IsUnknown()
+                     ? -1
+                     : static_cast<int>(info.position.position());
+  const char* reason = DeoptimizeReasonToString(info.deopt_reason);
+  bool optimization_disabled =
+      shared->optimization_disabled() &&
+      shared->disable_optimization_reason() == kDeoptimizationLoop;
+  std::unique_ptr<char[]> name = shared->DebugName()->ToCString();
+
+  if (tracing_enabled) {
+    std::ostringstream data;
+    data << "{\"type\":\"" << MessageFor(bailout_type_)
+         << "\",\"reason\":\"" << reason << "\",\"position\":" << position
+         << ",\"optimization_disabled\":"
+         << (optimization_disabled ? "true" : "false") << "}";
+    std::string data_string = data.str();
+    TRACE_EVENT_INSTANT2(TRACE_DISABLED_BY_DEFAULT("v8.deopt"),
+                         "V8.Deoptimize", TRACE_EVENT_SCOPE_THREAD, "function",
+                         TRACE_STR_COPY(name.get()), "data",
+                         TRACE_STR_COPY(data_string.c_str()));
+  }
+
+  if (handler != nullptr) {
+    STATIC_ASSERT(static_cast<int>(v8::DeoptimizationEvent::EAGER) == EAGER);
+    STATIC_ASSERT(static_cast<int>(v8::DeoptimizationEvent::LAZY) == LAZY);
+    STATIC_ASSERT(static_cast<int>(v8::DeoptimizationEvent::SOFT) == SOFT);
+    v8::DeoptimizationEvent event;
+    event.type = static_cast<v8::DeoptimizationEvent::BailoutType>(
+        bailout_type_);
+    event.name.str = name.get();
+    event.name.len = strlen(name.get());
+    event.script_id = shared->script()->IsScript()
+                          ? Script::cast(shared->script())->id()
+                          : -1;
+    event.position = position;
+    event.reason = reason;
+    event.optimization_disabled = optimization_disabled;
+    handler(reinterpret_cast<v8::Isolate*>(isolate_), &event);
+  }
+}
+
 
 void Deoptimizer::PrintFunctionName() {
   if (function_ != nullptr && function_->IsJSFunction()) {
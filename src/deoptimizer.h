@@ -516,6 +516,7 @@ class Deoptimizer : public Malloced {
   Deoptimizer(Isolate* isolate, JSFunction* function, BailoutType type,
               unsigned bailout_id, Address from, int fp_to_sp_delta);
   Code* FindOptimizedCode(JSFunction* function);
+  void ReportDeoptimizationEvent(JSFunction* function);
   void PrintFunctionName();
   void DeleteFrameDescriptions();
 
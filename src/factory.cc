@@ -1382,6 +1382,14 @@ Handle<JSFunction> Factory::NewFunctionFromSharedFunctionInfo(
     Compiler::PostInstantiation(result, pretenure);
   }
 
+  if (FLAG_flush_bytecode &&
+      result->code()->is_interpreter_trampoline_builtin()) {
+    // A closure allocated black during incremental marking is not visited by
+    // the marker, so the code flusher would not reset it to CompileLazy when
+    // the bytecode is flushed. Visit it explicitly to make it a candidate.
+    isolate()->heap()->incremental_marking()->IterateBlackObject(*result);
+  }
+
   return result;
 }
 
@@ -2255,6 +2263,15 @@ Handle<DebugInfo> Factory::NewDebugInfo(Handle<SharedFunctionInfo> shared) {
   // Link debug info to function.
   shared->set_debug_info(*debug_info);
 
+  // The debugger holds on to the original bytecode, which a bytecode flushing
+  // candidate only refers to weakly.
+  Heap* heap = isolate()->heap();
+  if (FLAG_flush_bytecode && shared->HasBytecodeArray() &&
+      heap->incremental_marking()->IsMarking() &&
+      heap->mark_compact_collector()->is_code_flushing_enabled()) {
+    heap->mark_compact_collector()->code_flusher()->EvictCandidate(*shared);
+  }
+
   return debug_info;
 }
 
@@ -293,18 +293,20 @@ DEFINE_BOOL(string_slices, true, "use string slices")
 DEFINE_BOOL(ignition, false, "use ignition interpreter")
 DEFINE_BOOL(ignition_staging, false, "use ignition with all staged features")
 DEFINE_IMPLICATION(ignition_staging, ignition)
-DEFINE_IMPLICATION(ignition_staging, ignition_osr)
 DEFINE_IMPLICATION(ignition_staging, turbo_from_bytecode)
 DEFINE_IMPLICATION(ignition_staging, ignition_preserve_bytecode)
 DEFINE_BOOL(ignition_eager, false, "eagerly compile and parse with ignition")
 DEFINE_STRING(ignition_filter, "*", "filter for ignition interpreter")
 DEFINE_BOOL(ignition_deadcode, true,
             "use ignition dead code elimination optimizer")
-DEFINE_BOOL(ignition_osr, false, "enable support for OSR from ignition code")
+DEFINE_BOOL(ignition_osr, true, "enable support for OSR from ignition code")
 DEFINE_BOOL(ignition_peephole, true, "use ignition peephole optimizer")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
+DEFINE_BOOL(lazy_source_positions, false,
+            "omit source position tables of bytecode for inner functions "
+            "and collect them lazily when needed")
 DEFINE_BOOL(ignition_preserve_bytecode, false,
             "preserve generated bytecode even when switching tiers")
 DEFINE_BOOL(print_bytecode, false,
@@ -380,6 +382,10 @@ DEFINE_BOOL(trap_on_deopt, false, "put a break point before deoptimizing")
 DEFINE_BOOL(trap_on_stub_deopt, false,
             "put a break point before deoptimizing a stub")
 DEFINE_BOOL(deoptimize_uncommon_cases, true, "deoptimize uncommon cases")
+DEFINE_INT(deopt_loop_threshold, 8,
+           "number of eager deoptimizations in a row (at most 15) after "
+           "which a function is no longer optimized "
+           "(0 disables deopt loop detection)")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(array_bounds_checks_elimination, true,
@@ -419,6 +425,18 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
 
+// compiler-dispatcher.cc
+DEFINE_BOOL(compiler_dispatcher, false,
+            "parse top-level function bodies of large scripts ahead of their "
+            "first call on background threads")
+DEFINE_BOOL(trace_compiler_dispatcher, false,
+            "trace compiler dispatcher activity")
+DEFINE_INT(compiler_dispatcher_min_function_size, 4 * KB,
+           "minimum source length of functions handed to the compiler "
+           "dispatcher")
+DEFINE_INT(compiler_dispatcher_max_jobs, 256,
+           "maximum number of functions pending in the compiler dispatcher")
+
 DEFINE_BOOL(omit_map_checks_for_leaf_maps, true,
             "do not emit check maps for constant values that have a leaf map, "
             "deoptimize the optimized code if the layout of the maps changes.")
@@ -426,7 +444,6 @@ DEFINE_BOOL(omit_map_checks_for_leaf_maps, true,
 // Flags for TurboFan.
 DEFINE_BOOL(turbo, false, "enable TurboFan compiler")
 DEFINE_IMPLICATION(turbo, turbo_asm_deoptimization)
-DEFINE_IMPLICATION(turbo, turbo_loop_peeling)
 DEFINE_BOOL(turbo_from_bytecode, false, "enable building graphs from bytecode")
 DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
@@ -476,8 +493,10 @@ DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_stress_loop_peeling, false,
             "stress loop peeling optimization")
-DEFINE_BOOL(turbo_loop_peeling, false, "Turbofan loop peeling")
+DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
+DEFINE_BOOL(turbo_bounds_check_elimination, true,
+            "eliminate bounds checks dominated by loop conditions in TurboFan")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_cache_shared_code, true, "cache context-independent code")
@@ -635,6 +654,9 @@ DEFINE_BOOL(trace_stub_failures, false,
 DEFINE_BOOL(serialize_toplevel, true, "enable caching of toplevel scripts")
 DEFINE_BOOL(serialize_eager, false, "compile eagerly when caching scripts")
 DEFINE_BOOL(serialize_age_code, false, "pre age code in the code cache")
+DEFINE_BOOL(serialize_preparse_data, false,
+            "embed preparse data in the code cache, used to skip preparsing "
+            "lazy functions if the cached code is rejected")
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
 
 // compiler.cc
@@ -642,9 +664,23 @@ DEFINE_INT(min_preparse_length, 1024,
            "minimum length for automatic enable preparsing")
 DEFINE_INT(max_opt_count, 10,
            "maximum number of optimization attempts before giving up.")
+DEFINE_BOOL(lazy_feedback_allocation, false,
+            "allocate literals and type feedback vectors of closures on "
+            "their first invocation")
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(compilation_cache_size, 0,
+           "bound each compilation sub-cache to this many kBytes and evict "
+           "the least recently used entries, instead of aging them out "
+           "(0 to disable)")
+DEFINE_BOOL(shared_compilation_cache, false,
+            "share compiled top-level scripts between all isolates in the "
+            "process")
+DEFINE_INT(shared_compilation_cache_size, 32 * KB,
+           "maximum size of the shared compilation cache (in kBytes)")
+DEFINE_INT(shared_compilation_cache_min_source_length, 1024,
+           "minimum source length of scripts in the shared compilation cache")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -731,6 +767,9 @@ DEFINE_BOOL(weak_embedded_maps_in_optimized_code, true,
 DEFINE_BOOL(weak_embedded_objects_in_optimized_code, true,
             "make objects embedded in optimized code weak")
 DEFINE_BOOL(flush_code, true, "flush code that we expect not to use again")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush bytecode of interpreted functions that have become old "
+            "(requires code flushing and code aging)")
 DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
@@ -800,6 +839,8 @@ DEFINE_BOOL(use_idle_notification, true,
 DEFINE_BOOL(use_ic, true, "use inline caching")
 DEFINE_BOOL(trace_ic, false, "trace inline cache state transitions")
 DEFINE_BOOL(tf_load_ic_stub, true, "use TF LoadIC stub")
+DEFINE_INT(max_polymorphic_map_count, 4,
+           "maximum number of maps tracked by a polymorphic IC (at most 16)")
 
 // macro-assembler-ia32.cc
 DEFINE_BOOL(native_code_counters, false,
@@ -875,6 +916,8 @@ DEFINE_INT(hash_seed, 0,
            "Fixed seed to use to hash property keys (0 means random)"
            "(with snapshots this option cannot override the baked-in seed)")
 DEFINE_BOOL(trace_rail, false, "trace RAIL mode")
+DEFINE_INT(zone_segment_pool_size, 2048,
+           "maximum size of the pool of recycled zone segments (in kBytes)")
 
 // runtime.cc
 DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
@@ -908,6 +951,7 @@ DEFINE_BOOL(profile_hydrogen_code_stub_compilation, false,
 
 DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
+DEFINE_NEG_IMPLICATION(predictable, compiler_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sweeping)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compaction)
 DEFINE_NEG_IMPLICATION(predictable, memory_reducer)
@@ -8,6 +8,7 @@
 #include <sstream>
 
 #include "src/base/bits.h"
+#include "src/compiler.h"
 #include "src/deoptimizer.h"
 #include "src/frames-inl.h"
 #include "src/full-codegen/full-codegen.h"
@@ -1091,6 +1092,17 @@ FrameSummary FrameSummary::GetFirst(JavaScriptFrame* frame) {
   return frames.first();
 }
 
+void FrameSummary::EnsureSourcePositions() const {
+  if (abstract_code_->IsBytecodeArray()) {
+    Compiler::EnsureSourcePositions(function_);
+  }
+}
+
+int FrameSummary::SourcePosition() const {
+  EnsureSourcePositions();
+  return abstract_code_->SourcePosition(code_offset_);
+}
+
 void FrameSummary::Print() {
   PrintF("receiver: ");
   receiver_->ShortPrint();
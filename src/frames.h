@@ -715,6 +715,12 @@ class FrameSummary BASE_EMBEDDED {
   int code_offset() const { return code_offset_; }
   bool is_constructor() const { return is_constructor_; }
 
+  // Collects the source positions of the bytecode in case they were omitted
+  // at compile time. Might allocate.
+  void EnsureSourcePositions() const;
+  // Source position of the summarized code offset. Might allocate.
+  int SourcePosition() const;
+
   void Print();
 
  private:
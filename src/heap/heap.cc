@@ -13,6 +13,7 @@
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/conversions.h"
 #include "src/debug/debug.h"
@@ -125,6 +126,7 @@ Heap::Heap()
       nodes_died_in_new_space_(0),
       nodes_copied_in_new_space_(0),
       nodes_promoted_(0),
+      flushed_bytecode_size_(0),
       maximum_size_scavenges_(0),
       max_gc_pause_(0.0),
       total_gc_time_ms_(0.0),
@@ -388,6 +390,8 @@ void Heap::PrintShortHeapStatistics() {
                this->CommittedMemory() / KB);
   PrintIsolate(isolate_, "External memory reported: %6" V8PRIdPTR " KB\n",
                static_cast<intptr_t>(external_memory_ / KB));
+  PrintIsolate(isolate_, "Flushed bytecode        : %6" V8PRIdPTR " KB\n",
+               flushed_bytecode_size_ / KB);
   PrintIsolate(isolate_, "Total time spent in GC  : %.1f ms\n",
                total_gc_time_ms_);
 }
@@ -3062,6 +3066,7 @@ AllocationResult Heap::AllocateBytecodeArray(int length,
   instance->set_parameter_count(parameter_count);
   instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
   instance->set_osr_loop_nesting_level(0);
+  instance->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
   instance->set_constant_pool(constant_pool);
   instance->set_handler_table(empty_fixed_array());
   instance->set_source_position_table(empty_byte_array());
@@ -3425,6 +3430,8 @@ AllocationResult Heap::CopyBytecodeArray(BytecodeArray* bytecode_array) {
   copy->set_source_position_table(bytecode_array->source_position_table());
   copy->set_interrupt_budget(bytecode_array->interrupt_budget());
   copy->set_osr_loop_nesting_level(bytecode_array->osr_loop_nesting_level());
+  copy->set_bytecode_age(bytecode_array->bytecode_age(),
+                         bytecode_array->bytecode_age_parity());
   bytecode_array->CopyBytecodesTo(copy);
   return copy;
 }
@@ -4414,6 +4421,8 @@ void Heap::CheckMemoryPressure() {
       DisallowHeapAllocation no_recursive_gc;
       isolate()->optimizing_compile_dispatcher()->Flush();
     }
+    // Functions parsed ahead of their first call keep their ASTs alive.
+    isolate()->compiler_dispatcher()->AbortAll();
   }
   if (memory_pressure_level_.Value() == MemoryPressureLevel::kCritical) {
     CollectGarbageOnMemoryPressure("memory pressure");
@@ -4465,6 +4474,10 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
   MemoryPressureLevel previous = memory_pressure_level_.Value();
   memory_pressure_level_.SetValue(level);
+  if (level != MemoryPressureLevel::kNone) {
+    // Pooled zone segments are cheap to give back and easy to re-create.
+    isolate()->allocator()->ClearPool();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -1310,6 +1310,14 @@ class Heap {
 
   inline void IncrementNodesPromoted() { nodes_promoted_++; }
 
+  // Accumulated size of bytecode (including its metadata) that the code
+  // flusher has dropped from cold functions.
+  inline void IncrementFlushedBytecodeSize(intptr_t size) {
+    DCHECK_GE(size, 0);
+    flushed_bytecode_size_ += size;
+  }
+  inline intptr_t flushed_bytecode_size() { return flushed_bytecode_size_; }
+
   inline void IncrementYoungSurvivorsCounter(intptr_t survived) {
     DCHECK_GE(survived, 0);
     survived_last_scavenge_ = survived;
@@ -2178,6 +2186,7 @@ class Heap {
   int nodes_died_in_new_space_;
   int nodes_copied_in_new_space_;
   int nodes_promoted_;
+  intptr_t flushed_bytecode_size_;
 
   // This is the pretenuring trigger for allocation sites that are in maybe
   // tenure state. When we switched to the maximum new space size we deoptimize
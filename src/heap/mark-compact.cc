@@ -806,6 +806,7 @@ void MarkCompactCollector::Prepare() {
     AbortWeakCells();
     AbortTransitionArrays();
     AbortCompaction();
+    if (is_code_flushing_enabled()) code_flusher_->ClearBytecodeCandidates();
     if (heap_->UsingEmbedderHeapTracer()) {
       heap_->mark_compact_collector()->embedder_heap_tracer()->AbortTracing();
     }
@@ -1004,6 +1005,56 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
 }
 
 
+void CodeFlusher::ProcessBytecodeCandidates() {
+  Code* lazy_compile = isolate_->builtins()->builtin(Builtins::kCompileLazy);
+  Heap* heap = isolate_->heap();
+
+  for (int i = 0; i < bytecode_candidates_.length(); i++) {
+    SharedFunctionInfo* candidate = bytecode_candidates_[i];
+
+    // The candidate may have been recorded by an incremental marking cycle
+    // that was aborted, or it may have been recompiled or started debugging
+    // since it was recorded.
+    if (Marking::IsWhite(ObjectMarking::MarkBitFrom(candidate))) continue;
+    if (!candidate->HasBytecodeArray() || candidate->HasDebugInfo() ||
+        !candidate->code()->is_interpreter_trampoline_builtin()) {
+      continue;
+    }
+
+    BytecodeArray* bytecode = candidate->bytecode_array();
+    MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+    if (Marking::IsWhite(bytecode_mark)) {
+      if (FLAG_trace_code_flushing) {
+        PrintF("[code-flushing clears bytecode: ");
+        candidate->ShortPrint();
+        PrintF(" - age: %d]\n", bytecode->bytecode_age());
+      }
+      int size = bytecode->SizeIncludingMetadata();
+      heap->IncrementFlushedBytecodeSize(size);
+      isolate_->counters()->bytecode_arrays_flushed()->Increment();
+      isolate_->counters()->total_flushed_bytecode_size()->Increment(size);
+      // Always flush the optimized code map if there is one.
+      if (!candidate->OptimizedCodeMapIsCleared()) {
+        candidate->ClearOptimizedCodeMap();
+      }
+      candidate->ClearBytecodeArray();
+      candidate->set_code(lazy_compile);
+    }
+
+    Object** code_slot =
+        HeapObject::RawField(candidate, SharedFunctionInfo::kCodeOffset);
+    heap->mark_compact_collector()->RecordSlot(candidate, code_slot,
+                                               *code_slot);
+    Object** data_slot = HeapObject::RawField(
+        candidate, SharedFunctionInfo::kFunctionDataOffset);
+    heap->mark_compact_collector()->RecordSlot(candidate, data_slot,
+                                               *data_slot);
+  }
+
+  bytecode_candidates_.Clear();
+}
+
+
 void CodeFlusher::EvictCandidate(SharedFunctionInfo* shared_info) {
   // Make sure previous flushing decisions are revisited.
   isolate_->heap()->incremental_marking()->IterateBlackObject(shared_info);
@@ -1014,6 +1065,10 @@ void CodeFlusher::EvictCandidate(SharedFunctionInfo* shared_info) {
     PrintF("]\n");
   }
 
+  for (int i = bytecode_candidates_.length() - 1; i >= 0; i--) {
+    if (bytecode_candidates_[i] == shared_info) bytecode_candidates_.Remove(i);
+  }
+
   SharedFunctionInfo* candidate = shared_function_info_candidates_head_;
   SharedFunctionInfo* next_candidate;
   if (candidate == shared_info) {
@@ -151,10 +151,20 @@ class CodeFlusher {
   inline void AddCandidate(SharedFunctionInfo* shared_info);
   inline void AddCandidate(JSFunction* function);
 
+  // Interpreted functions all share the InterpreterEntryTrampoline, whose
+  // gc_metadata field therefore cannot be used to link them. Candidates for
+  // bytecode flushing are kept in a separate list instead.
+  inline void AddBytecodeCandidate(SharedFunctionInfo* shared_info);
+
   void EvictCandidate(SharedFunctionInfo* shared_info);
   void EvictCandidate(JSFunction* function);
 
+  // Bytecode candidates are recorded with raw pointers and are only valid for
+  // the marking cycle that recorded them.
+  void ClearBytecodeCandidates() { bytecode_candidates_.Clear(); }
+
   void ProcessCandidates() {
+    ProcessBytecodeCandidates();
     ProcessSharedFunctionInfoCandidates();
     ProcessJSFunctionCandidates();
   }
@@ -164,6 +174,7 @@ class CodeFlusher {
  private:
   void ProcessJSFunctionCandidates();
   void ProcessSharedFunctionInfoCandidates();
+  void ProcessBytecodeCandidates();
 
   static inline JSFunction** GetNextCandidateSlot(JSFunction* candidate);
   static inline JSFunction* GetNextCandidate(JSFunction* candidate);
@@ -181,6 +192,7 @@ class CodeFlusher {
   Isolate* isolate_;
   JSFunction* jsfunction_candidates_head_;
   SharedFunctionInfo* shared_function_info_candidates_head_;
+  List<SharedFunctionInfo*> bytecode_candidates_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeFlusher);
 };
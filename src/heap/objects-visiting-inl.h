@@ -438,6 +438,10 @@ void StaticMarkingVisitor<StaticVisitor>::VisitCode(Map* map,
   if (FLAG_age_code && !heap->isolate()->serializer_enabled()) {
     code->MakeOlder(heap->mark_compact_collector()->marking_parity());
   }
+  if (FLAG_flush_bytecode && code->kind() == Code::OPTIMIZED_FUNCTION &&
+      heap->mark_compact_collector()->is_code_flushing_enabled()) {
+    MarkInlinedFunctionsBytecode(heap, code);
+  }
   CodeBodyVisitor::Visit(map, object);
 }
 
@@ -458,6 +462,15 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
   }
   MarkCompactCollector* collector = heap->mark_compact_collector();
   if (collector->is_code_flushing_enabled()) {
+    if (IsFlushableBytecode(heap, shared)) {
+      // As with code below, the decision is postponed until marking is done
+      // because the bytecode might still be reached from the stack or from
+      // optimized code that can deoptimize into the interpreter.
+      collector->code_flusher()->AddBytecodeCandidate(shared);
+      // Treat the reference to the bytecode array weakly.
+      VisitSharedFunctionInfoWeakBytecode(heap, object);
+      return;
+    }
     if (IsFlushable(heap, shared)) {
       // This function's code looks flushable. But we have to postpone
       // the decision until we see all functions that point to the same
@@ -499,6 +512,15 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSFunction(Map* map,
     } else {
       // Visit all unoptimized code objects to prevent flushing them.
       StaticVisitor::MarkObject(heap, function->shared()->code());
+      // Optimized code, or code that is about to be optimized, needs the
+      // bytecode to deoptimize into or to build its graph from.
+      SharedFunctionInfo* shared = function->shared();
+      if (FLAG_flush_bytecode && shared->HasBytecodeArray() &&
+          (function->IsOptimized() || function->IsMarkedForOptimization() ||
+           function->IsMarkedForConcurrentOptimization() ||
+           function->IsInOptimizationQueue())) {
+        StaticVisitor::MarkObject(heap, shared->bytecode_array());
+      }
     }
   }
   VisitJSFunctionStrongCode(map, object);
@@ -514,6 +536,12 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSRegExp(Map* map,
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitBytecodeArray(
     Map* map, HeapObject* object) {
+  Heap* heap = map->GetHeap();
+  if (FLAG_flush_bytecode && FLAG_age_code &&
+      !heap->isolate()->serializer_enabled()) {
+    BytecodeArray::cast(object)->MakeOlder(
+        heap->mark_compact_collector()->marking_parity());
+  }
   StaticVisitor::VisitPointers(
       map->GetHeap(), object,
       HeapObject::RawField(object, BytecodeArray::kConstantPoolOffset),
@@ -568,6 +596,13 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(Heap* heap,
                                                       JSFunction* function) {
   SharedFunctionInfo* shared_info = function->shared();
 
+  // Closures running in the interpreter share their code with all other
+  // interpreted functions, so only the bytecode decides about flushing.
+  if (function->code()->is_interpreter_trampoline_builtin()) {
+    return function->code() == shared_info->code() &&
+           IsFlushableBytecode(heap, shared_info);
+  }
+
   // Code is either on stack, in compilation cache or referenced
   // by optimized version of function.
   MarkBit code_mark = ObjectMarking::MarkBitFrom(function->code());
@@ -657,6 +692,96 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
 }
 
 
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsFlushableBytecode(
+    Heap* heap, SharedFunctionInfo* shared_info) {
+  if (!FLAG_flush_bytecode) return false;
+
+  // Only bytecode that is run through the interpreter entry trampoline can be
+  // flushed; functions with baseline code keep their bytecode.
+  if (!shared_info->HasBytecodeArray() ||
+      !shared_info->code()->is_interpreter_trampoline_builtin()) {
+    return false;
+  }
+
+  // Bytecode is either on stack or referenced by optimized code.
+  BytecodeArray* bytecode = shared_info->bytecode_array();
+  MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+  if (Marking::IsBlackOrGrey(bytecode_mark)) {
+    return false;
+  }
+
+  // The source code has to be available to recompile the function.
+  if (!HasSourceCode(heap, shared_info)) {
+    return false;
+  }
+
+  // Function must be lazy compilable.
+  if (!shared_info->allows_lazy_compilation()) {
+    return false;
+  }
+
+  // We do not flush bytecode of generators or async functions, because their
+  // suspended activations resume at a bytecode offset.
+  if (shared_info->is_resumable()) {
+    return false;
+  }
+
+  // If this is a full script wrapped in a function we do not flush.
+  if (shared_info->is_toplevel()) {
+    return false;
+  }
+
+  // The function must not be a builtin.
+  if (shared_info->IsBuiltin()) {
+    return false;
+  }
+
+  // The debugger keeps its own copy of the bytecode with break points.
+  if (shared_info->HasDebugInfo()) {
+    return false;
+  }
+
+  // If this is a function initialized with %SetCode then the one-to-one
+  // relation between SharedFunctionInfo and Code is broken.
+  if (shared_info->dont_flush()) {
+    return false;
+  }
+
+  // Check age of bytecode. If code aging is disabled we never flush.
+  if (!FLAG_age_code || !bytecode->IsOld()) {
+    return false;
+  }
+
+  return true;
+}
+
+
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::MarkInlinedFunctionsBytecode(
+    Heap* heap, Code* code) {
+  // Deoptimization of optimized code materializes interpreter frames for the
+  // function itself and for every function inlined into it.
+  DeoptimizationInputData* const data =
+      DeoptimizationInputData::cast(code->deoptimization_data());
+  if (data->length() == 0) return;
+  Object* outer = data->SharedFunctionInfo();
+  if (outer->IsSharedFunctionInfo() &&
+      SharedFunctionInfo::cast(outer)->HasBytecodeArray()) {
+    StaticVisitor::MarkObject(
+        heap, SharedFunctionInfo::cast(outer)->bytecode_array());
+  }
+  FixedArray* const literals = data->LiteralArray();
+  int const inlined_count = data->InlinedFunctionCount()->value();
+  for (int i = 0; i < inlined_count; ++i) {
+    SharedFunctionInfo* inlined = SharedFunctionInfo::cast(literals->get(i));
+    if (inlined->HasBytecodeArray()) {
+      StaticVisitor::MarkObject(heap, inlined->bytecode_array());
+    }
+  }
+}
+
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoStrongCode(
     Heap* heap, HeapObject* object) {
@@ -689,6 +814,22 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakCode(
 }
 
 
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakBytecode(
+    Heap* heap, HeapObject* object) {
+  Object** start_slot = HeapObject::RawField(
+      object, SharedFunctionInfo::BodyDescriptor::kStartOffset);
+  Object** data_slot =
+      HeapObject::RawField(object, SharedFunctionInfo::kFunctionDataOffset);
+  StaticVisitor::VisitPointers(heap, object, start_slot, data_slot);
+
+  // Skip visiting kFunctionDataOffset as it is treated weakly here.
+  Object** end_slot = HeapObject::RawField(
+      object, SharedFunctionInfo::BodyDescriptor::kEndOffset);
+  StaticVisitor::VisitPointers(heap, object, data_slot + 1, end_slot);
+}
+
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitJSFunctionStrongCode(
     Map* map, HeapObject* object) {
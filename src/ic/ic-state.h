@@ -11,7 +11,13 @@ namespace v8 {
 namespace internal {
 
 
-const int kMaxKeyedPolymorphism = 4;
+// Upper bound for the number of maps a polymorphic IC can track; the actual
+// limit is --max-polymorphic-map-count.
+const int kMaxPolymorphicMapCount = 16;
+
+// Polymorphic feedback with more maps than this is kept sorted by map address
+// so that the IC stubs can binary search it. Maps are never moved by the GC.
+const int kMaxLinearPolymorphicMapCount = 4;
 
 
 class ICUtility : public AllStatic {
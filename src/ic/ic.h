@@ -75,6 +75,11 @@ class IC {
            kind == Code::STORE_IC || kind == Code::KEYED_STORE_IC;
   }
 
+  // Returns the number of receiver maps after which an IC goes megamorphic.
+  static int MaxPolymorphism() {
+    return Max(1, Min(FLAG_max_polymorphic_map_count, kMaxPolymorphicMapCount));
+  }
+
   static InlineCacheState StateFromCode(Code* code);
 
  protected:
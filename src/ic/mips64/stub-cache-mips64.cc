@@ -136,6 +136,9 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Register receiver,
   ProbeTable(this, masm, kPrimary, receiver, name, scratch, extra, extra2,
              extra3);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1,
+                      extra2, extra3);
+
   // Primary miss: Compute hash for secondary probe.
   __ Subu(scratch, scratch, name);
   __ Addu(scratch, scratch, kSecondaryMagic);
@@ -52,11 +52,17 @@ Code* StubCache::Set(Name* name, Map* map, Code* code) {
 
   // If the primary entry has useful data in it, we retire it to the
   // secondary cache before overwriting it.
-  if (old_code != isolate_->builtins()->builtin(Builtins::kIllegal)) {
+  Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
+  if (old_code != empty) {
     Map* old_map = primary->map;
     int seed = PrimaryOffset(primary->key, old_map);
     int secondary_offset = SecondaryOffset(primary->key, seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    Counters* counters = isolate()->counters();
+    counters->megamorphic_stub_cache_primary_collisions()->Increment();
+    if (secondary->value != empty) {
+      counters->megamorphic_stub_cache_secondary_collisions()->Increment();
+    }
     *secondary = *primary;
   }
 
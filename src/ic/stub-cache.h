@@ -15,6 +15,11 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// With --native-code-counters, generated probes count all probes, the probes
+// that miss the primary table and try the secondary table, and the probes
+// that miss both. Smi receivers miss without probing either table. Set()
+// counts entries that it retires to, or evicts from, the secondary table.
 
 
 class SCTableReference {
@@ -91,9 +96,11 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
+  // The table sizes are baked into the probing code (and thus into the
+  // snapshot), so they cannot be changed at runtime.
+  static const int kPrimaryTableBits = 12;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  static const int kSecondaryTableBits = 10;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   // Some magic number used in primary and secondary hash computations.
@@ -127,6 +127,8 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Register receiver,
   // Probe the primary table.
   ProbeTable(this, masm, kPrimary, receiver, name, scratch);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1);
+
   // Primary miss: Compute hash for secondary probe.
   __ movl(scratch, FieldOperand(name, Name::kHashFieldOffset));
   __ addl(scratch, FieldOperand(receiver, HeapObject::kMapOffset));
@@ -174,6 +174,8 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Register receiver,
   // Probe the primary table.
   ProbeTable(this, masm, kPrimary, name, receiver, offset, extra);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1);
+
   // Primary miss: Compute hash for secondary probe.
   __ mov(offset, FieldOperand(name, Name::kHashFieldOffset));
   __ add(offset, FieldOperand(receiver, HeapObject::kMapOffset));
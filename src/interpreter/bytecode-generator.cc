@@ -667,7 +667,7 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
           info->isolate(), info->zone(), info->num_parameters_including_this(),
           info->scope()->MaxNestedContextChainLength(),
           info->scope()->num_stack_slots(), info->literal(),
-          info->SourcePositionRecordingMode())),
+          info->BytecodeSourcePositionRecordingMode())),
       info_(info),
       scope_(info->scope()),
       globals_builder_(new (zone()) GlobalDeclarationsBuilder(info->zone())),
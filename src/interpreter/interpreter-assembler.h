@@ -201,6 +201,10 @@ class InterpreterAssembler : public CodeStubAssembler {
   void CallPrologue() override;
   void CallEpilogue() override;
 
+  // Increments the call count in the CallIC feedback slot |slot_id|.
+  void IncrementCallCount(compiler::Node* type_feedback_vector,
+                          compiler::Node* slot_id);
+
   // Increment the dispatch counter for the (current, next) bytecode pair.
   void TraceBytecodeDispatch(compiler::Node* target_index);
 
@@ -203,6 +203,12 @@ InterpreterCompilationJob::Status InterpreterCompilationJob::FinalizeJobImpl() {
     os << std::flush;
   }
 
+  if (bytecodes->source_position_table()->length() == 0 &&
+      info()->SourcePositionRecordingMode() ==
+          SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS) {
+    isolate()->counters()->bytecode_source_positions_omitted()->Increment();
+  }
+
   info()->SetBytecodeArray(bytecodes);
   info()->SetCode(info()->isolate()->builtins()->InterpreterEntryTrampoline());
   return SUCCEEDED;
@@ -21,7 +21,9 @@
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
 #include "src/compilation-statistics.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/compiler.h"
 #include "src/crankshaft/hydrogen.h"
 #include "src/debug/debug.h"
 #include "src/deoptimizer.h"
@@ -621,7 +623,7 @@ class CaptureStackTraceHelper {
   }
 
   Handle<JSObject> NewStackFrameObject(FrameSummary& summ) {
-    int position = summ.abstract_code()->SourcePosition(summ.code_offset());
+    int position = summ.SourcePosition();
     return NewStackFrameObject(summ.function(), position,
                                summ.is_constructor());
   }
@@ -1403,6 +1405,8 @@ void Isolate::PrintCurrentStackTrace(FILE* out) {
     AbstractCode* abstract_code;
     int code_offset;
     if (frame->is_interpreted()) {
+      Compiler::EnsureSourcePositions(
+          handle(JavaScriptFrame::cast(frame)->function(), this));
       InterpretedFrame* iframe = reinterpret_cast<InterpretedFrame*>(frame);
       abstract_code = AbstractCode::cast(iframe->GetBytecodeArray());
       code_offset = iframe->GetBytecodeOffset();
@@ -1438,7 +1442,7 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   StandardFrame* frame = it.frame();
   // TODO(clemensh): handle wasm frames
   if (!frame->is_java_script()) return false;
-  JSFunction* fun = JavaScriptFrame::cast(frame)->function();
+  Handle<JSFunction> fun(JavaScriptFrame::cast(frame)->function(), this);
   Object* script = fun->shared()->script();
   if (!script->IsScript() ||
       (Script::cast(script)->source()->IsUndefined(this))) {
@@ -1451,8 +1455,8 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
   JavaScriptFrame::cast(frame)->Summarize(&frames);
   FrameSummary& summary = frames.last();
-  int pos = summary.abstract_code()->SourcePosition(summary.code_offset());
-  *target = MessageLocation(casted_script, pos, pos + 1, handle(fun, this));
+  int pos = summary.SourcePosition();
+  *target = MessageLocation(casted_script, pos, pos + 1, fun);
   return true;
 }
 
@@ -1507,6 +1511,9 @@ bool Isolate::ComputeLocationFromStackTrace(MessageLocation* target,
     Object* script = fun->shared()->script();
     if (script->IsScript() &&
         !(Script::cast(script)->source()->IsUndefined(this))) {
+      if (elements->Code(i)->IsBytecodeArray()) {
+        Compiler::EnsureSourcePositions(fun);
+      }
       AbstractCode* abstract_code = elements->Code(i);
       const int code_offset = elements->Offset(i)->value();
       const int pos = abstract_code->SourcePosition(code_offset);
@@ -1976,6 +1983,7 @@ Isolate::Isolate(bool enable_serializer)
       function_entry_hook_(NULL),
       deferred_handles_head_(NULL),
       optimizing_compile_dispatcher_(NULL),
+      compiler_dispatcher_(NULL),
       stress_deopt_count_(0),
       virtual_handler_register_(NULL),
       virtual_slot_register_(NULL),
@@ -1986,6 +1994,8 @@ Isolate::Isolate(bool enable_serializer)
 #endif
       is_running_microtasks_(false),
       use_counter_callback_(NULL),
+      deoptimization_event_handler_(NULL),
+      function_compilation_event_handler_(NULL),
       basic_block_profiler_(NULL),
       cancelable_task_manager_(new CancelableTaskManager()),
       abort_on_uncaught_exception_callback_(NULL) {
@@ -2002,6 +2012,11 @@ Isolate::Isolate(bool enable_serializer)
   heap_.isolate_ = this;
   stack_guard_.isolate_ = this;
 
+  // Recycle zone segments across compilations instead of going back to
+  // malloc() for every new zone.
+  allocator_->ConfigurePool(static_cast<size_t>(FLAG_zone_segment_pool_size) *
+                            KB);
+
   // ThreadManager is initialized early to support locking an isolate
   // before it is entered.
   thread_manager_ = new ThreadManager();
@@ -2085,6 +2100,9 @@ void Isolate::Deinit() {
     optimizing_compile_dispatcher_ = NULL;
   }
 
+  delete compiler_dispatcher_;
+  compiler_dispatcher_ = NULL;
+
   if (heap_.mark_compact_collector()->sweeping_in_progress()) {
     heap_.mark_compact_collector()->EnsureSweepingCompleted();
   }
@@ -2404,6 +2422,8 @@ bool Isolate::Init(Deserializer* des) {
     optimizing_compile_dispatcher_ = new OptimizingCompileDispatcher(this);
   }
 
+  compiler_dispatcher_ = new CompilerDispatcher(this, FLAG_stack_size);
+
   // Initialize runtime profiler before deserialization, because collections may
   // occur, clearing/updating ICs.
   runtime_profiler_ = new RuntimeProfiler(this);
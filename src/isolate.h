@@ -47,6 +47,7 @@ class CodeStubDescriptor;
 class CodeTracer;
 class CompilationCache;
 class CompilationStatistics;
+class CompilerDispatcher;
 class ContextSlotCache;
 class Counters;
 class CpuFeatures;
@@ -1048,6 +1049,8 @@ class Isolate {
     return optimizing_compile_dispatcher_;
   }
 
+  CompilerDispatcher* compiler_dispatcher() { return compiler_dispatcher_; }
+
   int id() const { return static_cast<int>(id_); }
 
   HStatistics* GetHStatistics();
@@ -1115,6 +1118,23 @@ class Isolate {
   void SetUseCounterCallback(v8::Isolate::UseCounterCallback callback);
   void CountUsage(v8::Isolate::UseCounterFeature feature);
 
+  v8::DeoptimizationEventHandler deoptimization_event_handler() const {
+    return deoptimization_event_handler_;
+  }
+  void set_deoptimization_event_handler(
+      v8::DeoptimizationEventHandler handler) {
+    deoptimization_event_handler_ = handler;
+  }
+
+  v8::FunctionCompilationEventHandler function_compilation_event_handler()
+      const {
+    return function_compilation_event_handler_;
+  }
+  void set_function_compilation_event_handler(
+      v8::FunctionCompilationEventHandler handler) {
+    function_compilation_event_handler_ = handler;
+  }
+
   BasicBlockProfiler* GetOrCreateBasicBlockProfiler();
   BasicBlockProfiler* basic_block_profiler() { return basic_block_profiler_; }
 
@@ -1403,6 +1423,7 @@ class Isolate {
 
   DeferredHandles* deferred_handles_head_;
   OptimizingCompileDispatcher* optimizing_compile_dispatcher_;
+  CompilerDispatcher* compiler_dispatcher_;
 
   // Counts deopt points if deopt_every_n_times is enabled.
   unsigned int stress_deopt_count_;
@@ -1430,6 +1451,8 @@ class Isolate {
   bool is_running_microtasks_;
 
   v8::Isolate::UseCounterCallback use_counter_callback_;
+  v8::DeoptimizationEventHandler deoptimization_event_handler_;
+  v8::FunctionCompilationEventHandler function_compilation_event_handler_;
   BasicBlockProfiler* basic_block_profiler_;
 
   List<Object*> partial_snapshot_cache_;
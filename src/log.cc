@@ -12,6 +12,7 @@
 #include "src/base/platform/platform.h"
 #include "src/bootstrapper.h"
 #include "src/code-stubs.h"
+#include "src/compiler.h"
 #include "src/counters.h"
 #include "src/deoptimizer.h"
 #include "src/global-handles.h"
@@ -846,7 +847,20 @@ void Logger::CodeDeoptEvent(Code* code, Address pc, int fp_to_sp_delta) {
   if (!log_->IsEnabled() || !FLAG_log_internal_timer_events) return;
   Log::MessageBuilder msg(log_);
   int since_epoch = static_cast<int>(timer_.Elapsed().InMicroseconds());
-  msg.Append("code-deopt,%d,%d", since_epoch, code->CodeSize());
+  msg.Append("code-deopt,%d,%d,", since_epoch, code->CodeSize());
+  DeoptimizationInputData* data =
+      DeoptimizationInputData::cast(code->deoptimization_data());
+  SharedFunctionInfo* shared =
+      SharedFunctionInfo::cast(data->SharedFunctionInfo());
+  Deoptimizer::DeoptInfo info = Deoptimizer::GetDeoptInfo(code, pc);
+  int position = info.position.IsUnknown()
+                     ? -1
+                     : static_cast<int>(info.position.position());
+  msg.Append('"');
+  msg.AppendDetailed(shared->DebugName(), false);
+  msg.Append("\",");
+  msg.Append("\"%s\",", DeoptimizeReasonToString(info.deopt_reason));
+  msg.Append("%d,%d", position, shared->deopt_count());
   msg.WriteToLogFile();
 }
 
@@ -1630,6 +1644,9 @@ void Logger::LogCompiledFunctions() {
   for (int i = 0; i < compiled_funcs_count; ++i) {
     if (code_objects[i].is_identical_to(isolate_->builtins()->CompileLazy()))
       continue;
+    // Line information of existing functions comes from their source position
+    // table, which might not have been collected yet.
+    Compiler::EnsureSourcePositions(sfis[i]);
     LogExistingFunction(sfis[i], code_objects[i]);
   }
 }
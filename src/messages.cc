@@ -7,6 +7,7 @@
 #include <memory>
 
 #include "src/api.h"
+#include "src/compiler.h"
 #include "src/execution.h"
 #include "src/isolate-inl.h"
 #include "src/keys.h"
@@ -525,7 +526,10 @@ MaybeHandle<FixedArray> GetStackFrames(Isolate* isolate,
       frames->set(i, *callsite);
     } else {
       Handle<Object> recv(elems->Receiver(i), isolate);
-      Handle<Object> fun(elems->Function(i), isolate);
+      Handle<JSFunction> fun(elems->Function(i), isolate);
+      // Source positions of bytecode may have been omitted at compile time,
+      // they are only collected once the stack trace is actually formatted.
+      if (code->IsBytecodeArray()) Compiler::EnsureSourcePositions(fun);
       Handle<Object> pos(Smi::FromInt(code->SourcePosition(pc->value())),
                          isolate);
 
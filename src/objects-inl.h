@@ -4148,6 +4148,24 @@ void BytecodeArray::set_osr_loop_nesting_level(int depth) {
   WRITE_INT8_FIELD(this, kOSRNestingLevelOffset, depth);
 }
 
+BytecodeArray::Age BytecodeArray::bytecode_age() const {
+  return AgeBits::decode(READ_UINT8_FIELD(this, kBytecodeAgeOffset));
+}
+
+MarkingParity BytecodeArray::bytecode_age_parity() const {
+  return AgeParityBits::decode(READ_UINT8_FIELD(this, kBytecodeAgeOffset));
+}
+
+void BytecodeArray::set_bytecode_age(BytecodeArray::Age age,
+                                     MarkingParity parity) {
+  DCHECK_GE(age, kFirstBytecodeAge);
+  DCHECK_LE(age, kLastBytecodeAge);
+  STATIC_ASSERT(kLastBytecodeAge <= AgeBits::kMax);
+  STATIC_ASSERT(NO_MARKING_PARITY == 0 && kNoAgeBytecodeAge == 0);
+  WRITE_UINT8_FIELD(this, kBytecodeAgeOffset,
+                    AgeBits::encode(age) | AgeParityBits::encode(parity));
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
@@ -5826,6 +5844,12 @@ bool Script::hide_source() { return BooleanBit::get(flags(), kHideSourceBit); }
 void Script::set_hide_source(bool value) {
   set_flags(BooleanBit::set(flags(), kHideSourceBit, value));
 }
+bool Script::serializable_code() {
+  return BooleanBit::get(flags(), kSerializableCodeBit);
+}
+void Script::set_serializable_code(bool value) {
+  set_flags(BooleanBit::set(flags(), kSerializableCodeBit, value));
+}
 Script::CompilationState Script::compilation_state() {
   return BooleanBit::get(flags(), kCompilationStateBit) ?
       COMPILATION_STATE_COMPILED : COMPILATION_STATE_INITIAL;
@@ -6157,8 +6181,20 @@ void SharedFunctionInfo::ReplaceCode(Code* value) {
   Code::VerifyRecompiledCode(code(), value);
 #endif  // DEBUG
 
+  bool was_interpreted = code()->is_interpreter_trampoline_builtin();
   set_code(value);
 
+  // Bytecode flushing candidates are not linked through the shared
+  // InterpreterEntryTrampoline. Evict them once the code changed, so that
+  // revisiting the function marks the bytecode that it still refers to.
+  if (FLAG_flush_bytecode && was_interpreted &&
+      GetHeap()->incremental_marking()->IsMarking()) {
+    MarkCompactCollector* collector = GetHeap()->mark_compact_collector();
+    if (collector->is_code_flushing_enabled()) {
+      collector->code_flusher()->EvictCandidate(this);
+    }
+  }
+
   if (is_compiled()) set_never_compiled(false);
 }
 
@@ -6337,6 +6373,24 @@ void SharedFunctionInfo::set_opt_reenable_tries(int tries) {
 }
 
 
+int SharedFunctionInfo::deopt_loop_count() {
+  return DeoptLoopCountBits::decode(counters());
+}
+
+
+void SharedFunctionInfo::set_deopt_loop_count(int deopt_loop_count) {
+  set_counters(DeoptLoopCountBits::update(counters(), deopt_loop_count));
+}
+
+
+void SharedFunctionInfo::increment_deopt_loop_count() {
+  int value = counters();
+  int deopt_loop_count = DeoptLoopCountBits::decode(value);
+  if (deopt_loop_count < DeoptLoopCountBits::kMax) deopt_loop_count++;
+  set_counters(DeoptLoopCountBits::update(value, deopt_loop_count));
+}
+
+
 int SharedFunctionInfo::opt_count() {
   return OptCountBits::decode(opt_count_and_bailout_reason());
 }
@@ -6497,6 +6551,13 @@ void JSFunction::ReplaceCode(Code* code) {
     // TODO(titzer): linear in the number of optimized functions; fix!
     context()->native_context()->RemoveOptimizedFunction(this);
   }
+
+  // A closure that was marked black before it got the trampoline would
+  // otherwise keep running in the interpreter after its bytecode is flushed.
+  // Revisit it so that it becomes a code flushing candidate.
+  if (FLAG_flush_bytecode && code->is_interpreter_trampoline_builtin()) {
+    GetHeap()->incremental_marking()->IterateBlackObject(this);
+  }
 }
 
 
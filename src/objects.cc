@@ -13578,6 +13578,7 @@ void SharedFunctionInfo::ResetForNewContext(int new_ic_age) {
     }
     set_opt_count(0);
     set_deopt_count(0);
+    set_deopt_loop_count(0);
   } else if (code()->is_interpreter_trampoline_builtin()) {
     set_profiler_ticks(0);
     if (optimization_disabled() && opt_count() >= FLAG_max_opt_count) {
@@ -13586,6 +13587,7 @@ void SharedFunctionInfo::ResetForNewContext(int new_ic_age) {
     }
     set_opt_count(0);
     set_deopt_count(0);
+    set_deopt_loop_count(0);
   }
 }
 
@@ -14720,6 +14722,19 @@ void BytecodeArray::CopyBytecodesTo(BytecodeArray* to) {
             from->length());
 }
 
+void BytecodeArray::MakeOlder(MarkingParity current_parity) {
+  Age age = bytecode_age();
+  if (age < kLastBytecodeAge && bytecode_age_parity() != current_parity) {
+    set_bytecode_age(static_cast<Age>(age + 1), current_parity);
+  }
+  DCHECK_GE(bytecode_age(), kFirstBytecodeAge);
+  DCHECK_LE(bytecode_age(), kLastBytecodeAge);
+}
+
+bool BytecodeArray::IsOld() const {
+  return bytecode_age() >= kIsOldBytecodeAge;
+}
+
 int BytecodeArray::LookupRangeInHandlerTable(
     int code_offset, int* data, HandlerTable::CatchPrediction* prediction) {
   HandlerTable* table = HandlerTable::cast(handler_table());
@@ -17397,7 +17412,8 @@ Handle<ObjectHashSet> ObjectHashSet::Add(Handle<ObjectHashSet> set,
 
 Handle<Object> CompilationCacheTable::Lookup(Handle<String> src,
                                              Handle<Context> context,
-                                             LanguageMode language_mode) {
+                                             LanguageMode language_mode,
+                                             uint32_t* hash) {
   Isolate* isolate = GetIsolate();
   Handle<SharedFunctionInfo> shared(context->closure()->shared());
   StringSharedKey key(src, shared, language_mode, kNoSourcePosition);
@@ -17405,13 +17421,14 @@ Handle<Object> CompilationCacheTable::Lookup(Handle<String> src,
   if (entry == kNotFound) return isolate->factory()->undefined_value();
   int index = EntryToIndex(entry);
   if (!get(index)->IsFixedArray()) return isolate->factory()->undefined_value();
+  if (hash != nullptr) *hash = key.Hash();
   return Handle<Object>(get(index + 1), isolate);
 }
 
 
 Handle<Object> CompilationCacheTable::LookupEval(
     Handle<String> src, Handle<SharedFunctionInfo> outer_info,
-    LanguageMode language_mode, int scope_position) {
+    LanguageMode language_mode, int scope_position, uint32_t* hash) {
   Isolate* isolate = GetIsolate();
   // Cache key is the tuple (source, outer shared function info, scope position)
   // to unambiguously identify the context chain the cached eval code assumes.
@@ -17420,24 +17437,28 @@ Handle<Object> CompilationCacheTable::LookupEval(
   if (entry == kNotFound) return isolate->factory()->undefined_value();
   int index = EntryToIndex(entry);
   if (!get(index)->IsFixedArray()) return isolate->factory()->undefined_value();
+  if (hash != nullptr) *hash = key.Hash();
   return Handle<Object>(get(EntryToIndex(entry) + 1), isolate);
 }
 
 
 Handle<Object> CompilationCacheTable::LookupRegExp(Handle<String> src,
-                                                   JSRegExp::Flags flags) {
+                                                   JSRegExp::Flags flags,
+                                                   uint32_t* hash) {
   Isolate* isolate = GetIsolate();
   DisallowHeapAllocation no_allocation;
   RegExpKey key(src, flags);
   int entry = FindEntry(&key);
   if (entry == kNotFound) return isolate->factory()->undefined_value();
+  if (hash != nullptr) *hash = key.Hash();
   return Handle<Object>(get(EntryToIndex(entry) + 1), isolate);
 }
 
 
 Handle<CompilationCacheTable> CompilationCacheTable::Put(
     Handle<CompilationCacheTable> cache, Handle<String> src,
-    Handle<Context> context, LanguageMode language_mode, Handle<Object> value) {
+    Handle<Context> context, LanguageMode language_mode, Handle<Object> value,
+    uint32_t* hash) {
   Isolate* isolate = cache->GetIsolate();
   Handle<SharedFunctionInfo> shared(context->closure()->shared());
   StringSharedKey key(src, shared, language_mode, kNoSourcePosition);
@@ -17447,6 +17468,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::Put(
   cache->set(EntryToIndex(entry), *k);
   cache->set(EntryToIndex(entry) + 1, *value);
   cache->ElementAdded();
+  if (hash != nullptr) *hash = key.Hash();
   return cache;
 }
 
@@ -17481,7 +17503,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
 
 Handle<CompilationCacheTable> CompilationCacheTable::PutRegExp(
       Handle<CompilationCacheTable> cache, Handle<String> src,
-      JSRegExp::Flags flags, Handle<FixedArray> value) {
+      JSRegExp::Flags flags, Handle<FixedArray> value, uint32_t* hash) {
   RegExpKey key(src, flags);
   cache = EnsureCapacity(cache, 1, &key);
   int entry = cache->FindInsertionEntry(key.Hash());
@@ -17490,6 +17512,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutRegExp(
   cache->set(EntryToIndex(entry), *value);
   cache->set(EntryToIndex(entry) + 1, *value);
   cache->ElementAdded();
+  if (hash != nullptr) *hash = key.Hash();
   return cache;
 }
 
@@ -17511,7 +17534,8 @@ void CompilationCacheTable::Age() {
       } else {
         NoWriteBarrierSet(this, value_index, count);
       }
-    } else if (get(entry_index)->IsFixedArray()) {
+    } else if (get(entry_index)->IsFixedArray() &&
+               FLAG_compilation_cache_size == 0) {
       SharedFunctionInfo* info = SharedFunctionInfo::cast(get(value_index));
       if (info->code()->kind() != Code::FUNCTION || info->code()->IsOld()) {
         NoWriteBarrierSet(this, entry_index, the_hole_value);
@@ -17538,6 +17562,31 @@ void CompilationCacheTable::Remove(Object* value) {
   return;
 }
 
+
+bool CompilationCacheTable::RemoveEntry(uint32_t hash, Object* value) {
+  DisallowHeapAllocation no_allocation;
+  Isolate* isolate = GetIsolate();
+  Object* undefined = isolate->heap()->undefined_value();
+  Object* the_hole_value = isolate->heap()->the_hole_value();
+  // Follow the probe sequence of the hash, like FindEntry does.
+  uint32_t capacity = Capacity();
+  uint32_t count = 1;
+  for (uint32_t entry = FirstProbe(hash, capacity);;
+       entry = NextProbe(entry, count++, capacity)) {
+    int entry_index = EntryToIndex(entry);
+    int value_index = entry_index + 1;
+    Object* element = get(entry_index);
+    if (element == undefined) return false;
+    if (element != the_hole_value && get(value_index) == value) {
+      NoWriteBarrierSet(this, entry_index, the_hole_value);
+      NoWriteBarrierSet(this, value_index, the_hole_value);
+      ElementRemoved();
+      return true;
+    }
+  }
+}
+
+
 template <typename Derived, typename Shape, typename Key>
 Handle<Derived> Dictionary<Derived, Shape, Key>::New(
     Isolate* isolate, int at_least_space_for, PretenureFlag pretenure,
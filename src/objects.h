@@ -4685,6 +4685,20 @@ class ByteArray: public FixedArrayBase {
 // BytecodeArray represents a sequence of interpreter bytecodes.
 class BytecodeArray : public FixedArrayBase {
  public:
+  enum Age {
+    kNoAgeBytecodeAge = 0,
+    kQuadragenarianBytecodeAge,
+    kQuinquagenarianBytecodeAge,
+    kSexagenarianBytecodeAge,
+    kSeptuagenarianBytecodeAge,
+    kOctogenarianBytecodeAge,
+    kAfterLastBytecodeAge,
+    kFirstBytecodeAge = kNoAgeBytecodeAge,
+    kLastBytecodeAge = kAfterLastBytecodeAge - 1,
+    kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
+    kIsOldBytecodeAge = kSexagenarianBytecodeAge
+  };
+
   static int SizeFor(int length) {
     return OBJECT_POINTER_ALIGN(kHeaderSize + length);
   }
@@ -4715,6 +4729,16 @@ class BytecodeArray : public FixedArrayBase {
   inline int osr_loop_nesting_level() const;
   inline void set_osr_loop_nesting_level(int depth);
 
+  // Accessors for bytecode's code age. The age is reset to kNoAgeBytecodeAge
+  // by the InterpreterEntryTrampoline on every call and incremented by the
+  // marking visitor at most once per marking phase. The byte at
+  // kBytecodeAgeOffset also holds the MarkingParity of the last increment;
+  // storing zero resets both, like the young code age sequence does.
+  inline Age bytecode_age() const;
+  inline void set_bytecode_age(Age age,
+                               MarkingParity parity = NO_MARKING_PARITY);
+  inline MarkingParity bytecode_age_parity() const;
+
   // Accessors for the constant pool.
   DECL_ACCESSORS(constant_pool, FixedArray)
 
@@ -4746,6 +4770,10 @@ class BytecodeArray : public FixedArrayBase {
 
   void CopyBytecodesTo(BytecodeArray* to);
 
+  // Bytecode aging
+  bool IsOld() const;
+  void MakeOlder(MarkingParity current_parity);
+
   int LookupRangeInHandlerTable(int code_offset, int* data,
                                 HandlerTable::CatchPrediction* prediction);
 
@@ -4758,7 +4786,12 @@ class BytecodeArray : public FixedArrayBase {
   static const int kParameterSizeOffset = kFrameSizeOffset + kIntSize;
   static const int kInterruptBudgetOffset = kParameterSizeOffset + kIntSize;
   static const int kOSRNestingLevelOffset = kInterruptBudgetOffset + kIntSize;
-  static const int kHeaderSize = kOSRNestingLevelOffset + kCharSize;
+  static const int kBytecodeAgeOffset = kOSRNestingLevelOffset + kCharSize;
+  static const int kHeaderSize = kBytecodeAgeOffset + kCharSize;
+
+  // Encoding of the byte at kBytecodeAgeOffset.
+  class AgeBits : public BitField8<Age, 0, 4> {};
+  class AgeParityBits : public BitField8<MarkingParity, 4, 2> {};
 
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
@@ -6768,6 +6801,12 @@ class Script: public Struct {
   inline v8::ScriptOriginOptions origin_options();
   inline void set_origin_options(ScriptOriginOptions origin_options);
 
+  // [serializable_code]: determines whether lazily compiled functions of the
+  // script are prepared for serialization, so that a code cache can still be
+  // created after the script ran. Encoded in the 'flags' field.
+  inline bool serializable_code();
+  inline void set_serializable_code(bool value);
+
   DECLARE_CAST(Script)
 
   // If script source is an external string, check that the underlying
@@ -6865,6 +6904,8 @@ class Script: public Struct {
   static const int kOriginOptionsSize = 3;
   static const int kOriginOptionsMask = ((1 << kOriginOptionsSize) - 1)
                                         << kOriginOptionsShift;
+  static const int kSerializableCodeBit =
+      kOriginOptionsShift + kOriginOptionsSize;
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(Script);
 };
@@ -7352,9 +7393,16 @@ class SharedFunctionInfo: public HeapObject {
   inline void set_opt_reenable_tries(int value);
   inline int opt_reenable_tries();
 
+  // Number of eager deoptimizations in a row, without any other kind of
+  // deoptimization or a profiler tick in optimized code in between.
+  inline void set_deopt_loop_count(int value);
+  inline int deopt_loop_count();
+  inline void increment_deopt_loop_count();
+
   inline void TryReenableOptimization();
 
-  // Stores deopt_count, opt_reenable_tries and ic_age as bit-fields.
+  // Stores deopt_count, opt_reenable_tries, deopt_loop_count and ic_age as
+  // bit-fields.
   inline void set_counters(int value);
   inline int counters() const;
 
@@ -7607,7 +7655,8 @@ class SharedFunctionInfo: public HeapObject {
   class FunctionKindBits : public BitField<FunctionKind, kIsArrow, 9> {};
 
   class DeoptCountBits : public BitField<int, 0, 4> {};
-  class OptReenableTriesBits : public BitField<int, 4, 18> {};
+  class OptReenableTriesBits : public BitField<int, 4, 14> {};
+  class DeoptLoopCountBits : public BitField<int, 18, 4> {};
   class ICAgeBits : public BitField<int, 22, 8> {};
 
   class OptCountBits : public BitField<int, 0, 22> {};
@@ -8446,29 +8495,42 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
 // Such entries are identified by SharedFunctionInfos pointing to either the
 // recompilation stub, or to "old" code. This avoids memory leaks due to
 // premature caching of scripts and eval strings that are never needed later.
+//
+// If --compilation_cache_size is set, Age keeps all actual cache entries. The
+// owner then keeps track of the order in which entries are used, using the
+// hashes returned by the lookup and put functions, and bounds the table with
+// RemoveEntry instead.
 class CompilationCacheTable: public HashTable<CompilationCacheTable,
                                               CompilationCacheShape,
                                               HashTableKey*> {
  public:
-  // Find cached value for a string key, otherwise return null.
-  Handle<Object> Lookup(
-      Handle<String> src, Handle<Context> context, LanguageMode language_mode);
-  Handle<Object> LookupEval(
-      Handle<String> src, Handle<SharedFunctionInfo> shared,
-      LanguageMode language_mode, int scope_position);
-  Handle<Object> LookupRegExp(Handle<String> source, JSRegExp::Flags flags);
+  // Find cached value for a string key, otherwise return null. If |hash| is
+  // not null, it receives the hash of the entry that was found.
+  Handle<Object> Lookup(Handle<String> src, Handle<Context> context,
+                        LanguageMode language_mode, uint32_t* hash = nullptr);
+  Handle<Object> LookupEval(Handle<String> src,
+                            Handle<SharedFunctionInfo> shared,
+                            LanguageMode language_mode, int scope_position,
+                            uint32_t* hash = nullptr);
+  Handle<Object> LookupRegExp(Handle<String> source, JSRegExp::Flags flags,
+                              uint32_t* hash = nullptr);
+  // If |hash| is not null, it receives the hash of the added entry.
   static Handle<CompilationCacheTable> Put(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<Context> context, LanguageMode language_mode,
-      Handle<Object> value);
+      Handle<Object> value, uint32_t* hash = nullptr);
   static Handle<CompilationCacheTable> PutEval(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<SharedFunctionInfo> context, Handle<SharedFunctionInfo> value,
       int scope_position);
   static Handle<CompilationCacheTable> PutRegExp(
       Handle<CompilationCacheTable> cache, Handle<String> src,
-      JSRegExp::Flags flags, Handle<FixedArray> value);
+      JSRegExp::Flags flags, Handle<FixedArray> value,
+      uint32_t* hash = nullptr);
   void Remove(Object* value);
+  // Removes the entry with the given hash and value, without scanning the
+  // whole table. Returns false if there is no such entry.
+  bool RemoveEntry(uint32_t hash, Object* value);
   void Age();
   static const int kHashGenerations = 10;
 
@@ -27,9 +27,12 @@ ParseInfo::ParseInfo(Zone* zone)
       end_position_(0),
       isolate_(nullptr),
       cached_data_(nullptr),
+      preparse_data_(nullptr),
       ast_value_factory_(nullptr),
       function_name_(nullptr),
-      literal_(nullptr) {}
+      literal_(nullptr) {
+  zone->set_kind(base::AccountingAllocator::kParserZone);
+}
 
 ParseInfo::ParseInfo(Zone* zone, Handle<JSFunction> function)
     : ParseInfo(zone, Handle<SharedFunctionInfo>(function->shared())) {
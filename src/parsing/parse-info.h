@@ -57,6 +57,7 @@ class ParseInfo {
   FLAG_ACCESSOR(kIsNamedExpression, is_named_expression,
                 set_is_named_expression)
   FLAG_ACCESSOR(kCallsEval, calls_eval, set_calls_eval)
+  FLAG_ACCESSOR(kSuppressErrors, suppress_errors, set_suppress_errors)
 
 #undef FLAG_ACCESSOR
 
@@ -95,6 +96,11 @@ class ParseInfo {
   ScriptData** cached_data() const { return cached_data_; }
   void set_cached_data(ScriptData** cached_data) { cached_data_ = cached_data; }
 
+  ScriptData** preparse_data() const { return preparse_data_; }
+  void set_preparse_data(ScriptData** preparse_data) {
+    preparse_data_ = preparse_data;
+  }
+
   ScriptCompiler::CompileOptions compile_options() const {
     return compile_options_;
   }
@@ -200,8 +206,9 @@ class ParseInfo {
     kAllowLazyParsing = 1 << 8,
     kIsNamedExpression = 1 << 9,
     kCallsEval = 1 << 10,
+    kSuppressErrors = 1 << 11,
     // ---------- Output flags --------------------------
-    kAstValueFactoryOwned = 1 << 11
+    kAstValueFactoryOwned = 1 << 12
   };
 
   //------------- Inputs to parsing and scope analysis -----------------------
@@ -228,6 +235,7 @@ class ParseInfo {
 
   //----------- Inputs+Outputs of parsing and scope analysis -----------------
   ScriptData** cached_data_;  // used if available, populated if requested.
+  ScriptData** preparse_data_;  // populated with function entries if set.
   AstValueFactory* ast_value_factory_;  // used if available, otherwise new.
   const AstRawString* function_name_;
 
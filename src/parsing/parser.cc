@@ -596,6 +596,7 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
   Handle<String> source(String::cast(info->script()->source()));
   isolate->counters()->total_parse_size()->Increment(source->length());
   base::ElapsedTimer timer;
+  size_t zone_size_before = zone()->allocation_size();
   if (FLAG_trace_parse) {
     timer.Start();
   }
@@ -604,7 +605,7 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
   // Initialize parser state.
   CompleteParserRecorder recorder;
 
-  if (produce_cached_parse_data()) {
+  if (produce_cached_parse_data() || info->preparse_data() != nullptr) {
     log_ = &recorder;
   } else if (consume_cached_parse_data()) {
     cached_parse_data_->Initialize();
@@ -647,11 +648,16 @@ FunctionLiteral* Parser::ParseProgram(Isolate* isolate, ParseInfo* info) {
     } else {
       PrintF("[parsing script");
     }
-    PrintF(" - took %0.3f ms]\n", ms);
+    PrintF(" - took %0.3f ms, %" PRIuS " bytes of zone]\n", ms,
+           zone()->allocation_size() - zone_size_before);
   }
   if (produce_cached_parse_data()) {
     if (result != NULL) *info->cached_data() = recorder.GetScriptData();
     log_ = NULL;
+  } else if (info->preparse_data() != nullptr) {
+    // The function entries are embedded into the code cache by the caller.
+    if (result != NULL) *info->preparse_data() = recorder.GetScriptData();
+    log_ = NULL;
   }
   return result;
 }
@@ -768,6 +774,7 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
   Handle<String> source(String::cast(info->script()->source()));
   isolate->counters()->total_parse_size()->Increment(source->length());
   base::ElapsedTimer timer;
+  size_t zone_size_before = zone()->allocation_size();
   if (FLAG_trace_parse) {
     timer.Start();
   }
@@ -804,7 +811,9 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
   if (FLAG_trace_parse && result != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
     std::unique_ptr<char[]> name_chars = result->debug_name()->ToCString();
-    PrintF("[parsing function: %s - took %0.3f ms]\n", name_chars.get(), ms);
+    PrintF("[parsing function: %s - took %0.3f ms, %" PRIuS
+           " bytes of zone]\n",
+           name_chars.get(), ms, zone()->allocation_size() - zone_size_before);
   }
   return result;
 }
@@ -4239,8 +4248,7 @@ void Parser::SkipLazyFunctionBody(int* materialized_literal_count,
   SetLanguageMode(scope, logger.language_mode());
   if (logger.uses_super_property()) scope->RecordSuperPropertyUsage();
   if (logger.calls_eval()) scope->RecordEvalCall();
-  if (produce_cached_parse_data()) {
-    DCHECK(log_);
+  if (log_ != nullptr) {
     // Position right after terminal '}'.
     int body_end = scanner()->location().end_pos;
     log_->LogFunction(function_block_pos, body_end, *materialized_literal_count,
@@ -5089,7 +5097,8 @@ bool Parser::Parse(ParseInfo* info) {
   }
   info->set_literal(result);
 
-  Internalize(isolate, info->script(), result == NULL);
+  Internalize(isolate, info->script(),
+              result == NULL && !info->suppress_errors());
   DCHECK(ast_value_factory()->IsInternalized());
   return (result != NULL);
 }
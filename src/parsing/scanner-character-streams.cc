@@ -25,6 +25,21 @@ size_t CopyUtf8CharsToUtf16Chars(uint16_t* dest, size_t length, const byte* src,
   // two free spaces in the buffer to be sure that the next character will fit.
   while (i < length - 1) {
     if (*src_pos == src_length) break;
+    // Most scripts are pure ASCII, so find the longest ASCII run that fits the
+    // buffer a word at a time and widen it in bulk. Only multi-byte sequences
+    // go through the decoder.
+    size_t run_length = Min(length - 1 - i, src_length - *src_pos);
+    size_t ascii_length = static_cast<size_t>(String::NonAsciiStart(
+        reinterpret_cast<const char*>(src + *src_pos),
+        static_cast<int>(run_length)));
+    if (ascii_length > 0) {
+      CopyChars(dest + i, src + *src_pos, ascii_length);
+      i += ascii_length;
+      *src_pos += ascii_length;
+      continue;
+    }
+    // NonAsciiStart checks whole words, so an ASCII character can still come
+    // before the multi-byte sequence.
     unibrow::uchar c = src[*src_pos];
     if (c <= unibrow::Utf8::kMaxOneByteChar) {
       *src_pos = *src_pos + 1;
@@ -501,9 +516,7 @@ size_t ExternalOneByteStringUtf16CharacterStream::BufferSeekForward(
 size_t ExternalOneByteStringUtf16CharacterStream::FillBuffer(size_t from_pos) {
   if (from_pos >= length_) return 0;
   size_t length = Min(kBufferSize, length_ - from_pos);
-  for (size_t i = 0; i < length; ++i) {
-    buffer_[i] = static_cast<uc16>(raw_data_[from_pos + i]);
-  }
+  CopyChars(buffer_, raw_data_ + from_pos, length);
   return length;
 }
 
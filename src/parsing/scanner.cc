@@ -11,11 +11,17 @@
 #include <cmath>
 
 #include "src/ast/ast-value-factory.h"
+#include "src/base/bits.h"
 #include "src/char-predicates-inl.h"
 #include "src/conversions-inl.h"
 #include "src/list-inl.h"
 #include "src/parsing/duplicate-finder.h"  // For Scanner::FindSymbol
 
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#define V8_SCANNER_USE_SSE2 1
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -27,6 +33,155 @@ Handle<String> Scanner::LiteralBuffer::Internalize(Isolate* isolate) const {
 }
 
 
+// ----------------------------------------------------------------------------
+// Bulk scanning kernels
+//
+// Each kernel describes a set of ASCII code units that the scanner can skip
+// (or copy into a literal) without looking at them individually. ScanRun
+// returns the length of the longest prefix of a buffered range made up of
+// such code units, eight at a time with SSE2 where available. Anything that
+// needs a closer look (non-ASCII code units, line terminators, escapes,
+// quotes) ends the run and is handled by the regular per-character code.
+
+namespace {
+
+#if V8_SCANNER_USE_SSE2
+
+inline __m128i AllOnes() { return _mm_set1_epi16(-1); }
+
+inline __m128i Equals(__m128i code_units, uint16_t c) {
+  return _mm_cmpeq_epi16(code_units, _mm_set1_epi16(static_cast<int16_t>(c)));
+}
+
+inline __m128i IsNonAscii(__m128i code_units) {
+  __m128i high_bits = _mm_and_si128(
+      code_units, _mm_set1_epi16(static_cast<int16_t>(0xff80)));
+  return _mm_andnot_si128(_mm_cmpeq_epi16(high_bits, _mm_setzero_si128()),
+                          AllOnes());
+}
+
+// Signed comparison, which is fine because code units >= 0x8000 are
+// negative and therefore never in an ASCII range.
+inline __m128i InRange(__m128i code_units, uint16_t lower, uint16_t upper) {
+  return _mm_and_si128(
+      _mm_cmpgt_epi16(code_units, _mm_set1_epi16(lower - 1)),
+      _mm_cmplt_epi16(code_units, _mm_set1_epi16(upper + 1)));
+}
+
+#endif  // V8_SCANNER_USE_SSE2
+
+inline bool IsAscii(uint16_t c) { return c <= unibrow::Utf8::kMaxOneByteChar; }
+
+inline bool IsAsciiLineTerminator(uint16_t c) {
+  return c == '\n' || c == '\r';
+}
+
+// Spaces and tabs, e.g. indentation.
+struct WhiteSpaceKernel {
+  bool Accepts(uint16_t c) const { return c == ' ' || c == '\t'; }
+#if V8_SCANNER_USE_SSE2
+  __m128i Rejects(__m128i c) const {
+    return _mm_andnot_si128(_mm_or_si128(Equals(c, ' '), Equals(c, '\t')),
+                            AllOnes());
+  }
+#endif
+};
+
+// Body of a single-line comment.
+struct SingleLineCommentKernel {
+  bool Accepts(uint16_t c) const {
+    return IsAscii(c) && !IsAsciiLineTerminator(c);
+  }
+#if V8_SCANNER_USE_SSE2
+  __m128i Rejects(__m128i c) const {
+    return _mm_or_si128(IsNonAscii(c),
+                        _mm_or_si128(Equals(c, '\n'), Equals(c, '\r')));
+  }
+#endif
+};
+
+// Body of a multi-line comment, up to a possible '*/'.
+struct MultiLineCommentKernel {
+  bool Accepts(uint16_t c) const {
+    return IsAscii(c) && !IsAsciiLineTerminator(c) && c != '*';
+  }
+#if V8_SCANNER_USE_SSE2
+  __m128i Rejects(__m128i c) const {
+    return _mm_or_si128(
+        _mm_or_si128(IsNonAscii(c), Equals(c, '*')),
+        _mm_or_si128(Equals(c, '\n'), Equals(c, '\r')));
+  }
+#endif
+};
+
+// ASCII identifier parts, i.e. [a-zA-Z0-9_$].
+struct IdentifierPartKernel {
+  bool Accepts(uint16_t c) const { return IsAsciiIdentifier(c); }
+#if V8_SCANNER_USE_SSE2
+  __m128i Rejects(__m128i c) const {
+    // Setting bit 5 maps 'A'-'Z' onto 'a'-'z' and nothing else onto 'a'-'z'.
+    __m128i lower = _mm_or_si128(c, _mm_set1_epi16(0x20));
+    __m128i accepts =
+        _mm_or_si128(_mm_or_si128(InRange(lower, 'a', 'z'),
+                                  InRange(c, '0', '9')),
+                     _mm_or_si128(Equals(c, '_'), Equals(c, '$')));
+    return _mm_andnot_si128(accepts, AllOnes());
+  }
+#endif
+};
+
+// Characters of a string literal that need neither escape processing nor
+// surrogate handling.
+struct StringBodyKernel {
+  explicit StringBodyKernel(uint16_t quote) : quote_(quote) {}
+  bool Accepts(uint16_t c) const {
+    return IsAscii(c) && c != quote_ && c != '\\' &&
+           !IsAsciiLineTerminator(c);
+  }
+#if V8_SCANNER_USE_SSE2
+  __m128i Rejects(__m128i c) const {
+    return _mm_or_si128(
+        _mm_or_si128(IsNonAscii(c), Equals(c, quote_)),
+        _mm_or_si128(Equals(c, '\\'),
+                     _mm_or_si128(Equals(c, '\n'), Equals(c, '\r'))));
+  }
+#endif
+
+ private:
+  uint16_t quote_;
+};
+
+template <typename Kernel>
+size_t ScanRun(const Kernel& kernel, const uint16_t* start,
+               const uint16_t* end) {
+  const uint16_t* cursor = start;
+#if V8_SCANNER_USE_SSE2
+  static const int kCodeUnitsPerVector = sizeof(__m128i) / sizeof(uint16_t);
+  while (end - cursor >= kCodeUnitsPerVector) {
+    __m128i code_units =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    uint32_t rejected =
+        static_cast<uint32_t>(_mm_movemask_epi8(kernel.Rejects(code_units)));
+    if (rejected != 0) {
+      // Two mask bits per code unit.
+      cursor += base::bits::CountTrailingZeros32(rejected) / 2;
+      return static_cast<size_t>(cursor - start);
+    }
+    cursor += kCodeUnitsPerVector;
+  }
+#endif
+  while (cursor < end && kernel.Accepts(*cursor)) ++cursor;
+  return static_cast<size_t>(cursor - start);
+}
+
+}  // namespace
+
+template <typename Kernel>
+size_t Scanner::ScanBufferedRun(const Kernel& kernel) {
+  return ScanRun(kernel, source_->buffered_start(), source_->buffered_end());
+}
+
+
 // Default implementation for streams that do not support bookmarks.
 bool Utf16CharacterStream::SetBookmark() { return false; }
 void Utf16CharacterStream::ResetToBookmark() { UNREACHABLE(); }
@@ -321,6 +476,7 @@ bool Scanner::SkipWhiteSpace() {
                  !IsLittleEndianByteOrderMark(c0_)) {
         break;
       }
+      SkipBuffered(ScanBufferedRun(WhiteSpaceKernel()), false);
       Advance();
     }
 
@@ -357,6 +513,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
   while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+    SkipBuffered(ScanBufferedRun(SingleLineCommentKernel()), false);
     Advance();
   }
 
@@ -429,7 +586,11 @@ Token::Value Scanner::SkipMultiLineComment() {
   DCHECK(c0_ == '*');
   Advance();
 
+  MultiLineCommentKernel kernel;
   while (c0_ >= 0) {
+    // Code units the kernel accepts are neither line terminators nor part of
+    // a '*/', so the run following one of them can be skipped in bulk.
+    if (kernel.Accepts(c0_)) SkipBuffered(ScanBufferedRun(kernel), false);
     uc32 ch = c0_;
     Advance();
     if (c0_ >= 0 && unicode_cache_->IsLineTerminator(ch)) {
@@ -902,8 +1063,9 @@ Token::Value Scanner::ScanString() {
     }
     char c = static_cast<char>(c0_);
     if (c == '\\') break;
-    Advance<false, false>();
     AddLiteralChar(c);
+    SkipBuffered(ScanBufferedRun(StringBodyKernel(quote)), true);
+    Advance<false, false>();
   }
 
   while (c0_ != quote && c0_ >= 0
@@ -1331,9 +1493,9 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
       Advance<false, false>();
       AddLiteralChar(first_char);
       while (IsAsciiIdentifier(c0_)) {
-        char first_char = static_cast<char>(c0_);
+        AddLiteralChar(static_cast<char>(c0_));
+        SkipBuffered(ScanBufferedRun(IdentifierPartKernel()), true);
         Advance<false, false>();
-        AddLiteralChar(first_char);
       }
       if (c0_ <= kMaxAscii && c0_ != '\\') {
         literal.Complete();
@@ -1353,9 +1515,9 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
     HandleLeadSurrogate();
   } else if (IsInRange(c0_, 'A', 'Z') || c0_ == '_' || c0_ == '$') {
     do {
-      char first_char = static_cast<char>(c0_);
+      AddLiteralChar(static_cast<char>(c0_));
+      SkipBuffered(ScanBufferedRun(IdentifierPartKernel()), true);
       Advance<false, false>();
-      AddLiteralChar(first_char);
     } while (IsAsciiIdentifier(c0_));
 
     if (c0_ <= kMaxAscii && c0_ != '\\') {
@@ -72,6 +72,14 @@ class Utf16CharacterStream {
     return SlowSeekForward(code_unit_count);
   }
 
+  // Returns the code units that are buffered but have not been returned by
+  // Advance() yet, i.e. [buffered_start(), buffered_end()). Bulk scanning
+  // loops look ahead through them and consume the prefix they are not
+  // interested in with SeekForward(). The range may be empty and is only
+  // valid until the stream is advanced.
+  inline const uint16_t* buffered_start() const { return buffer_cursor_; }
+  inline const uint16_t* buffered_end() const { return buffer_end_; }
+
   // Pushes back the most recently read UTF-16 code unit (or negative
   // value if at end of input), i.e., the value returned by the most recent
   // call to Advance.
@@ -332,6 +340,23 @@ class Scanner {
       }
     }
 
+    // Appends a run of ASCII code units.
+    void AddAsciiChars(const uint16_t* code_units, size_t length) {
+      if (!is_one_byte_) {
+        for (size_t i = 0; i < length; i++) AddChar(code_units[i]);
+        return;
+      }
+      while (position_ + static_cast<int>(length) > backing_store_.length()) {
+        ExpandBuffer();
+      }
+      for (size_t i = 0; i < length; i++) {
+        DCHECK_LE(code_units[i], unibrow::Utf8::kMaxOneByteChar);
+        backing_store_[position_ + static_cast<int>(i)] =
+            static_cast<byte>(code_units[i]);
+      }
+      position_ += static_cast<int>(length);
+    }
+
     bool is_one_byte() const { return is_one_byte_; }
 
     bool is_contextual_keyword(Vector<const char> keyword) const {
@@ -562,6 +587,26 @@ class Scanner {
     if (check_surrogate) HandleLeadSurrogate();
   }
 
+  // Returns the length of the run of code units following c0_ that are
+  // buffered in the source and accepted by {kernel} (see scanner.cc).
+  template <typename Kernel>
+  size_t ScanBufferedRun(const Kernel& kernel);
+
+  // Consumes the next {length} code units buffered in the source without
+  // updating c0_, optionally appending them to the current literal. Used
+  // together with the bulk scanning kernels in scanner.cc, which only accept
+  // ASCII code units that need no further processing.
+  void SkipBuffered(size_t length, bool add_to_literal) {
+    if (length == 0) return;
+    if (add_to_literal) {
+      DCHECK_NOT_NULL(next_.literal_chars);
+      next_.literal_chars->AddAsciiChars(source_->buffered_start(), length);
+    }
+    size_t skipped = source_->SeekForward(length);
+    DCHECK_EQ(length, skipped);
+    USE(skipped);
+  }
+
   void HandleLeadSurrogate() {
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
       uc32 c1 = source_->Advance();
@@ -162,7 +162,8 @@ void RuntimeProfiler::AttemptOnStackReplacement(JavaScriptFrame* frame,
     }
   } else if (frame->type() == StackFrame::INTERPRETED) {
     DCHECK(shared->HasBytecodeArray());
-    if (!FLAG_ignition_osr) return;  // Only use this when enabled.
+    // Only use this when enabled.
+    if (!FLAG_ignition_osr) return;
     int level = shared->bytecode_array()->osr_loop_nesting_level();
     shared->bytecode_array()->set_osr_loop_nesting_level(
         Min(level + loop_nesting_levels, AbstractCode::kMaxLoopNestingMarker));
@@ -212,9 +213,11 @@ void RuntimeProfiler::MaybeOptimizeFullCodegen(JSFunction* function,
 
   // Do not record non-optimizable functions.
   if (shared->optimization_disabled()) {
-    if (shared->deopt_count() >= FLAG_max_opt_count) {
+    if (shared->deopt_count() >= FLAG_max_opt_count &&
+        shared->disable_optimization_reason() != kDeoptimizationLoop) {
       // If optimization was disabled due to many deoptimizations,
       // then check if the function is hot and try to reenable optimization.
+      // Functions caught in a deoptimization loop stay unoptimized.
       int ticks = shared_code->profiler_ticks();
       if (ticks >= kProfilerTicksBeforeReenablingOptimization) {
         shared_code->set_profiler_ticks(0);
@@ -338,9 +341,11 @@ void RuntimeProfiler::MaybeOptimizeIgnition(JSFunction* function,
   }
 
   if (shared->optimization_disabled()) {
-    if (shared->deopt_count() >= FLAG_max_opt_count) {
+    if (shared->deopt_count() >= FLAG_max_opt_count &&
+        shared->disable_optimization_reason() != kDeoptimizationLoop) {
       // If optimization was disabled due to many deoptimizations,
       // then check if the function is hot and try to reenable optimization.
+      // Functions caught in a deoptimization loop stay unoptimized.
       if (ticks >= kProfilerTicksBeforeReenablingOptimization) {
         shared->set_profiler_ticks(0);
         shared->TryReenableOptimization();
@@ -402,6 +407,10 @@ void RuntimeProfiler::MarkCandidatesForOptimization() {
       }
     }
 
+    // A function whose optimized code runs long enough to be sampled is not
+    // caught in a deoptimization loop.
+    if (frame->is_optimized()) function->shared()->set_deopt_loop_count(0);
+
     Compiler::CompilationTier next_tier =
         Compiler::NextCompilationTier(function);
     if (function->shared()->code()->is_interpreter_trampoline_builtin()) {
@@ -9,6 +9,7 @@
 #include "src/accessors.h"
 #include "src/arguments.h"
 #include "src/ast/scopes.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/deoptimizer.h"
 #include "src/frames-inl.h"
 #include "src/isolate-inl.h"
@@ -144,6 +145,13 @@ Object* DeclareGlobals(Isolate* isolate, Handle<FixedArray> pairs, int flags,
       Handle<JSFunction> function =
           isolate->factory()->NewFunctionFromSharedFunctionInfo(shared, context,
                                                                 TENURED);
+      // Large top-level functions are likely to be called during startup;
+      // start parsing their bodies in the background right away.
+      if (FLAG_compiler_dispatcher && !shared->is_compiled() &&
+          shared->end_position() - shared->start_position() >=
+              FLAG_compiler_dispatcher_min_function_size) {
+        isolate->compiler_dispatcher()->Enqueue(function);
+      }
       value = function;
     } else {
       value = isolate->factory()->undefined_value();
@@ -7,6 +7,8 @@
 #include <memory>
 
 #include "src/code-stubs.h"
+#include "src/full-codegen/full-codegen.h"
+#include "src/interpreter/interpreter.h"
 #include "src/log.h"
 #include "src/macro-assembler.h"
 #include "src/snapshot/deserializer.h"
@@ -18,7 +20,8 @@ namespace internal {
 
 ScriptData* CodeSerializer::Serialize(Isolate* isolate,
                                       Handle<SharedFunctionInfo> info,
-                                      Handle<String> source) {
+                                      Handle<String> source,
+                                      ScriptData* preparse_data) {
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
   if (FLAG_trace_serializer) {
@@ -28,8 +31,15 @@ ScriptData* CodeSerializer::Serialize(Isolate* isolate,
     PrintF("]\n");
   }
 
+  uint32_t preparse_source_hash = 0;
+  if (preparse_data != nullptr) {
+    preparse_source_hash = SerializedCodeData::SourceContentHash(source);
+  }
+
   // Serialize code object.
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(source));
+  cs.preparse_data_ = preparse_data;
+  cs.preparse_source_hash_ = preparse_source_hash;
   DisallowHeapAllocation no_gc;
   cs.reference_map()->AddAttachedReference(*source);
   ScriptData* ret = cs.Serialize(info);
@@ -43,12 +53,65 @@ ScriptData* CodeSerializer::Serialize(Isolate* isolate,
   return ret;
 }
 
+ScriptData* CodeSerializer::SerializeAfterExecution(
+    Isolate* isolate, Handle<SharedFunctionInfo> info, Handle<String> source) {
+  DCHECK(info->is_toplevel());
+  // Full-codegen code without the relocation info needed for serialization
+  // is dropped and recompiled lazily after deserialization, which is not an
+  // option for top-level code.
+  Code* toplevel_code = info->code();
+  if (toplevel_code->kind() == Code::FUNCTION &&
+      !toplevel_code->has_reloc_info_for_serialization()) {
+    return nullptr;
+  }
+
+  // Inline caches may embed maps and other isolate-specific objects, and
+  // armed back edges and profiler ticks only describe how this process ran
+  // the code. The code is still in use, so reset them on copies that stand
+  // in for the original code only while serializing.
+  List<Handle<SharedFunctionInfo>> functions;
+  {
+    WeakFixedArray::Iterator iterator(
+        Script::cast(info->script())->shared_function_infos());
+    SharedFunctionInfo* shared;
+    while ((shared = iterator.Next<SharedFunctionInfo>())) {
+      Code* code = shared->code();
+      if (code->kind() == Code::FUNCTION &&
+          code->has_reloc_info_for_serialization()) {
+        functions.Add(handle(shared, isolate));
+      }
+    }
+  }
+  List<Handle<Code>> original_code(functions.length());
+  List<Handle<Code>> cleared_code(functions.length());
+  for (int i = 0; i < functions.length(); i++) {
+    Handle<Code> code(functions[i]->code(), isolate);
+    Handle<Code> copy = isolate->factory()->CopyCode(code);
+    copy->ClearInlineCaches();
+    BackEdgeTable::Revert(isolate, *copy);
+    copy->set_profiler_ticks(0);
+    original_code.Add(code);
+    cleared_code.Add(copy);
+  }
+
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < functions.length(); i++) {
+    functions[i]->set_code(*cleared_code[i]);
+  }
+  ScriptData* result = Serialize(isolate, info, source);
+  for (int i = 0; i < functions.length(); i++) {
+    functions[i]->set_code(*original_code[i]);
+  }
+  return result;
+}
+
 ScriptData* CodeSerializer::Serialize(Handle<HeapObject> obj) {
   DisallowHeapAllocation no_gc;
 
   VisitPointer(Handle<Object>::cast(obj).location());
   SerializeDeferredObjects();
   Pad();
+  RestoreExecutionState();
 
   SerializedCodeData data(sink()->data(), this);
 
@@ -98,6 +161,12 @@ void CodeSerializer::SerializeObject(HeapObject* obj, HowToCode how_to_code,
     UNREACHABLE();
   }
 
+  if (obj->IsSharedFunctionInfo()) {
+    PrepareSharedFunctionInfo(SharedFunctionInfo::cast(obj));
+  } else if (obj->IsScript()) {
+    PrepareScript(Script::cast(obj));
+  }
+
   // Past this point we should not see any (context-specific) maps anymore.
   CHECK(!obj->IsMap());
   // There should be no references to the global object embedded.
@@ -155,6 +224,85 @@ void CodeSerializer::SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
   PutAttachedReference(reference, how_to_code, where_to_point);
 }
 
+void CodeSerializer::PrepareSharedFunctionInfo(SharedFunctionInfo* shared) {
+  // Optimized code and literals are specific to the native context.
+  if (!shared->OptimizedCodeMapIsCleared()) {
+    optimized_functions_.Add(shared);
+    optimized_code_maps_.Add(shared->optimized_code_map());
+    shared->ClearOptimizedCodeMap();
+  }
+  // Full-codegen code compiled without serialization support cannot be
+  // serialized; the function is compiled lazily again after deserialization.
+  Code* code = shared->code();
+  if (code->kind() == Code::FUNCTION &&
+      !code->has_reloc_info_for_serialization()) {
+    lazified_functions_.Add(shared);
+    lazified_code_.Add(code);
+    shared->set_code(isolate()->builtins()->builtin(Builtins::kCompileLazy));
+  }
+  // Optimization counters, disabled optimization, profiler ticks, OSR arming
+  // and bytecode age only describe how this process ran the script.
+  TieringState state;
+  state.shared = shared;
+  state.optimization_disabled = shared->optimization_disabled();
+  state.opt_count_and_bailout_reason = shared->opt_count_and_bailout_reason();
+  state.counters = shared->counters();
+  state.profiler_ticks = shared->profiler_ticks();
+  shared->set_optimization_disabled(false);
+  shared->set_opt_count_and_bailout_reason(0);
+  shared->set_deopt_count(0);
+  shared->set_opt_reenable_tries(0);
+  shared->set_deopt_loop_count(0);
+  shared->set_profiler_ticks(0);
+  if (shared->HasBytecodeArray()) {
+    BytecodeArray* bytecode = shared->bytecode_array();
+    state.osr_loop_nesting_level = bytecode->osr_loop_nesting_level();
+    state.interrupt_budget = bytecode->interrupt_budget();
+    state.bytecode_age = bytecode->bytecode_age();
+    state.bytecode_age_parity = bytecode->bytecode_age_parity();
+    bytecode->set_osr_loop_nesting_level(0);
+    bytecode->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
+    bytecode->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
+  }
+  tiering_states_.Add(state);
+}
+
+void CodeSerializer::PrepareScript(Script* script) {
+  // The wrapper is a weak cell holding a JSValue of the native context.
+  if (script->wrapper()->IsUndefined(isolate())) return;
+  unwrapped_scripts_.Add(script);
+  script_wrappers_.Add(script->wrapper());
+  script->set_wrapper(isolate()->heap()->undefined_value());
+}
+
+void CodeSerializer::RestoreExecutionState() {
+  for (int i = 0; i < optimized_functions_.length(); i++) {
+    optimized_functions_[i]->set_optimized_code_map(optimized_code_maps_[i]);
+  }
+  for (int i = 0; i < lazified_functions_.length(); i++) {
+    lazified_functions_[i]->set_code(lazified_code_[i]);
+  }
+  for (int i = 0; i < unwrapped_scripts_.length(); i++) {
+    unwrapped_scripts_[i]->set_wrapper(script_wrappers_[i]);
+  }
+  for (int i = 0; i < tiering_states_.length(); i++) {
+    const TieringState& state = tiering_states_[i];
+    SharedFunctionInfo* shared = state.shared;
+    shared->set_optimization_disabled(state.optimization_disabled);
+    shared->set_opt_count_and_bailout_reason(
+        state.opt_count_and_bailout_reason);
+    shared->set_counters(state.counters);
+    shared->set_profiler_ticks(state.profiler_ticks);
+    if (shared->HasBytecodeArray()) {
+      BytecodeArray* bytecode = shared->bytecode_array();
+      bytecode->set_osr_loop_nesting_level(state.osr_loop_nesting_level);
+      bytecode->set_interrupt_budget(state.interrupt_budget);
+      bytecode->set_bytecode_age(state.bytecode_age,
+                                 state.bytecode_age_parity);
+    }
+  }
+}
+
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     Isolate* isolate, ScriptData* cached_data, Handle<String> source) {
   base::ElapsedTimer timer;
@@ -299,7 +447,13 @@ SerializedCodeData::SerializedCodeData(const List<byte>* payload,
   int stub_keys_size = stub_keys->length() * kInt32Size;
   int payload_offset = kHeaderSize + reservation_size + stub_keys_size;
   int padded_payload_offset = POINTER_SIZE_ALIGN(payload_offset);
-  int size = padded_payload_offset + payload->length();
+  ScriptData* preparse_data = cs->preparse_data();
+  int preparse_size = 0;
+  if (preparse_data != nullptr) {
+    preparse_size =
+        POINTER_SIZE_ALIGN(preparse_data->length()) + kPreparseTrailerSize;
+  }
+  int size = padded_payload_offset + payload->length() + preparse_size;
 
   // Allocate backing store and create result data.
   AllocateData(size);
@@ -329,6 +483,32 @@ SerializedCodeData::SerializedCodeData(const List<byte>* payload,
   CopyBytes(data_ + padded_payload_offset, payload->begin(),
             static_cast<size_t>(payload->length()));
 
+  // Append preparse data and its trailer.
+  if (preparse_data != nullptr) {
+    byte* preparse_start = data_ + padded_payload_offset + payload->length();
+    int preparse_length = preparse_data->length();
+    int padded_preparse_length = POINTER_SIZE_ALIGN(preparse_length);
+    CopyBytes(preparse_start, preparse_data->data(),
+              static_cast<size_t>(preparse_length));
+    memset(preparse_start + preparse_length, 0,
+           padded_preparse_length - preparse_length);
+    Checksum preparse_checksum(
+        Vector<const byte>(preparse_start, padded_preparse_length));
+    int trailer_offset = size - kPreparseTrailerSize;
+    SetHeaderValue(trailer_offset + kPreparseLengthOffset * kInt32Size,
+                   preparse_length);
+    SetHeaderValue(trailer_offset + kPreparseSourceHashOffset * kInt32Size,
+                   cs->preparse_source_hash());
+    SetHeaderValue(trailer_offset + kPreparseVersionHashOffset * kInt32Size,
+                   Version::Hash());
+    SetHeaderValue(trailer_offset + kPreparseFlagHashOffset * kInt32Size,
+                   FlagList::Hash());
+    SetHeaderValue(trailer_offset + kPreparseChecksumOffset * kInt32Size,
+                   preparse_checksum.a() ^ preparse_checksum.b());
+    SetHeaderValue(trailer_offset + kPreparseMagicOffset * kInt32Size,
+                   kPreparseTrailerMagicNumber);
+  }
+
   Checksum checksum(DataWithoutHeader());
   SetHeaderValue(kChecksum1Offset, checksum.a());
   SetHeaderValue(kChecksum2Offset, checksum.b());
@@ -358,6 +538,79 @@ uint32_t SerializedCodeData::SourceHash(Handle<String> source) {
   return source->length();
 }
 
+namespace {
+
+template <typename Char>
+uint32_t HashSourceChars(Vector<const Char> chars, uint32_t hash) {
+  // FNV-1a over the code units of the source.
+  for (int i = 0; i < chars.length(); i++) {
+    hash = (hash ^ chars[i]) * 16777619u;
+  }
+  return hash;
+}
+
+}  // namespace
+
+uint32_t SerializedCodeData::SourceContentHash(Handle<String> source) {
+  source = String::Flatten(source);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = source->GetFlatContent();
+  DCHECK(content.IsFlat());
+  uint32_t hash = 2166136261u ^ static_cast<uint32_t>(source->length());
+  if (content.IsOneByte()) {
+    return HashSourceChars(content.ToOneByteVector(), hash);
+  }
+  return HashSourceChars(content.ToUC16Vector(), hash);
+}
+
+ScriptData* SerializedCodeData::ExtractPreparseData(ScriptData* cached_data,
+                                                    Handle<String> source) {
+  const byte* data = cached_data->data();
+  int size = cached_data->length();
+  if (size < kHeaderSize + kPreparseTrailerSize ||
+      !IsAligned(size, kPointerAlignment)) {
+    return nullptr;
+  }
+  SerializedCodeData scd(data, size);
+  int trailer_offset = size - kPreparseTrailerSize;
+  if (scd.GetHeaderValue(trailer_offset + kPreparseMagicOffset * kInt32Size) !=
+      kPreparseTrailerMagicNumber) {
+    return nullptr;
+  }
+  uint32_t preparse_length =
+      scd.GetHeaderValue(trailer_offset + kPreparseLengthOffset * kInt32Size);
+  if (preparse_length > static_cast<uint32_t>(trailer_offset - kHeaderSize)) {
+    return nullptr;
+  }
+  int padded_preparse_length =
+      POINTER_SIZE_ALIGN(static_cast<int>(preparse_length));
+  if (padded_preparse_length > trailer_offset - kHeaderSize) return nullptr;
+  const byte* preparse_start = data + trailer_offset - padded_preparse_length;
+  Checksum preparse_checksum(
+      Vector<const byte>(preparse_start, padded_preparse_length));
+  if (scd.GetHeaderValue(trailer_offset +
+                         kPreparseChecksumOffset * kInt32Size) !=
+      (preparse_checksum.a() ^ preparse_checksum.b())) {
+    return nullptr;
+  }
+  // Preparse data recorded by another version or with other flags may
+  // describe the functions differently, e.g. their language mode.
+  if (scd.GetHeaderValue(trailer_offset +
+                         kPreparseVersionHashOffset * kInt32Size) !=
+          Version::Hash() ||
+      scd.GetHeaderValue(trailer_offset +
+                         kPreparseFlagHashOffset * kInt32Size) !=
+          FlagList::Hash()) {
+    return nullptr;
+  }
+  if (scd.GetHeaderValue(trailer_offset +
+                         kPreparseSourceHashOffset * kInt32Size) !=
+      SourceContentHash(source)) {
+    return nullptr;
+  }
+  return new ScriptData(preparse_start, static_cast<int>(preparse_length));
+}
+
 // Return ScriptData object and relinquish ownership over it to the caller.
 ScriptData* SerializedCodeData::GetScriptData() {
   DCHECK(owns_data_);
@@ -383,7 +636,7 @@ Vector<const byte> SerializedCodeData::Payload() const {
   const byte* payload = data_ + padded_payload_offset;
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
-  DCHECK_EQ(data_ + size_, payload + length);
+  DCHECK_LE(payload + length, data_ + size_);
   return Vector<const byte>(payload, length);
 }
 
@@ -13,9 +13,20 @@ namespace internal {
 
 class CodeSerializer : public Serializer {
  public:
+  // If |preparse_data| is given, it is embedded into the result so that the
+  // parser can still skip lazy functions if the cached code gets rejected.
   static ScriptData* Serialize(Isolate* isolate,
                                Handle<SharedFunctionInfo> info,
-                               Handle<String> source);
+                               Handle<String> source,
+                               ScriptData* preparse_data = nullptr);
+
+  // Like the above, but for a script that may already have run. The result
+  // also contains the code of functions that were compiled lazily, as far as
+  // that code is serializable. Returns nullptr if the top-level code itself
+  // cannot be serialized.
+  static ScriptData* SerializeAfterExecution(Isolate* isolate,
+                                             Handle<SharedFunctionInfo> info,
+                                             Handle<String> source);
 
   ScriptData* Serialize(Handle<HeapObject> obj);
 
@@ -26,9 +37,15 @@ class CodeSerializer : public Serializer {
 
   uint32_t source_hash() const { return source_hash_; }
 
+  ScriptData* preparse_data() const { return preparse_data_; }
+  uint32_t preparse_source_hash() const { return preparse_source_hash_; }
+
  protected:
   explicit CodeSerializer(Isolate* isolate, uint32_t source_hash)
-      : Serializer(isolate), source_hash_(source_hash) {}
+      : Serializer(isolate),
+        source_hash_(source_hash),
+        preparse_data_(nullptr),
+        preparse_source_hash_(0) {}
   ~CodeSerializer() override { OutputStatistics("CodeSerializer"); }
 
   virtual void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
@@ -48,9 +65,42 @@ class CodeSerializer : public Serializer {
   void SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
                          WhereToPoint where_to_point);
 
+  // Strip state that a script picks up while running before serializing the
+  // given objects. Changed fields are restored by RestoreExecutionState.
+  void PrepareSharedFunctionInfo(SharedFunctionInfo* shared);
+  void PrepareScript(Script* script);
+  void RestoreExecutionState();
+
   DisallowHeapAllocation no_gc_;
   uint32_t source_hash_;
+  ScriptData* preparse_data_;  // Not owned.
+  uint32_t preparse_source_hash_;
   List<uint32_t> stub_keys_;
+  // Functions whose optimized code map was temporarily cleared, and that map.
+  List<SharedFunctionInfo*> optimized_functions_;
+  List<FixedArray*> optimized_code_maps_;
+  // Functions whose unserializable code was temporarily replaced by the lazy
+  // compile builtin, and that code.
+  List<SharedFunctionInfo*> lazified_functions_;
+  List<Code*> lazified_code_;
+  // Scripts whose wrapper was temporarily cleared, and that wrapper.
+  List<Script*> unwrapped_scripts_;
+  List<HeapObject*> script_wrappers_;
+  // Tiering state that functions picked up while running, temporarily reset
+  // to the state of a freshly compiled function.
+  struct TieringState {
+    SharedFunctionInfo* shared;
+    bool optimization_disabled;
+    int opt_count_and_bailout_reason;
+    int counters;
+    int profiler_ticks;
+    // Only valid if the function has bytecode.
+    int osr_loop_nesting_level;
+    int interrupt_budget;
+    BytecodeArray::Age bytecode_age;
+    MarkingParity bytecode_age_parity;
+  };
+  List<TieringState> tiering_states_;
   DISALLOW_COPY_AND_ASSIGN(CodeSerializer);
 };
 
@@ -110,6 +160,19 @@ class SerializedCodeData : public SerializedData {
 
   static uint32_t SourceHash(Handle<String> source);
 
+  // Hash over the characters of |source|. Unlike SourceHash, this detects
+  // edits that leave the length of the source unchanged.
+  static uint32_t SourceContentHash(Handle<String> source);
+
+  // Returns the preparse data embedded into |cached_data|, or nullptr if there
+  // is none, if it does not belong to |source| or if it was produced by a
+  // different V8 version or with different flags. This does not depend on the
+  // header of the cached data, so it also works if the cached code itself is
+  // rejected, e.g. because of a CPU feature mismatch. The result does not own
+  // its data, which stays valid as long as |cached_data| does.
+  static ScriptData* ExtractPreparseData(ScriptData* cached_data,
+                                         Handle<String> source);
+
  private:
   explicit SerializedCodeData(ScriptData* data);
   SerializedCodeData(const byte* data, int size)
@@ -135,6 +198,15 @@ class SerializedCodeData : public SerializedData {
   // ...  reservations
   // ...  code stub keys
   // ...  serialized payload
+  // ...  preparse data (optional, padded to pointer size)
+  // The preparse data, if present, is followed by a trailer of uint32_t-sized
+  // entries at the very end of the data:
+  // [0] preparse data length
+  // [1] source content hash
+  // [2] version hash
+  // [3] flag hash
+  // [4] preparse data checksum
+  // [5] preparse trailer magic number
   static const int kVersionHashOffset = kMagicNumberOffset + kInt32Size;
   static const int kSourceHashOffset = kVersionHashOffset + kInt32Size;
   static const int kCpuFeaturesOffset = kSourceHashOffset + kInt32Size;
@@ -145,6 +217,16 @@ class SerializedCodeData : public SerializedData {
   static const int kChecksum1Offset = kPayloadLengthOffset + kInt32Size;
   static const int kChecksum2Offset = kChecksum1Offset + kInt32Size;
   static const int kHeaderSize = kChecksum2Offset + kInt32Size;
+
+  static const uint32_t kPreparseTrailerMagicNumber = 0x9E7A95E0;
+  static const int kPreparseLengthOffset = 0;
+  static const int kPreparseSourceHashOffset = kPreparseLengthOffset + 1;
+  static const int kPreparseVersionHashOffset = kPreparseSourceHashOffset + 1;
+  static const int kPreparseFlagHashOffset = kPreparseVersionHashOffset + 1;
+  static const int kPreparseChecksumOffset = kPreparseFlagHashOffset + 1;
+  static const int kPreparseMagicOffset = kPreparseChecksumOffset + 1;
+  static const int kPreparseTrailerSize =
+      (kPreparseMagicOffset + 1) * kInt32Size;
 };
 
 }  // namespace internal
@@ -4,6 +4,9 @@
 
 #include "src/type-feedback-vector.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/code-stubs.h"
 #include "src/ic/ic.h"
 #include "src/ic/ic-state.h"
@@ -235,6 +238,8 @@ Handle<TypeFeedbackVector> TypeFeedbackVector::New(
 
   Handle<FixedArray> array = factory->NewFixedArray(length, TENURED);
   array->set(kMetadataIndex, *metadata);
+  isolate->counters()->feedback_vectors_allocated()->Increment();
+  isolate->counters()->total_feedback_vector_size()->Increment(array->Size());
 
   DisallowHeapAllocation no_gc;
 
@@ -254,8 +259,13 @@ Handle<TypeFeedbackVector> TypeFeedbackVector::New(
       value = *uninitialized_sentinel;
     }
     array->set(index, value, SKIP_WRITE_BARRIER);
+
+    // CallICs count calls in their extra slot in every state.
+    Object* extra_value = kind == FeedbackVectorSlotKind::CALL_IC
+                              ? Smi::FromInt(0)
+                              : *uninitialized_sentinel;
     for (int j = 1; j < entry_size; j++) {
-      array->set(index + j, *uninitialized_sentinel, SKIP_WRITE_BARRIER);
+      array->set(index + j, extra_value, SKIP_WRITE_BARRIER);
     }
     i += entry_size;
   }
@@ -436,11 +446,20 @@ void FeedbackNexus::InstallHandlers(Handle<FixedArray> array,
                                     MapHandleList* maps,
                                     List<Handle<Object>>* handlers) {
   int receiver_count = maps->length();
+  std::vector<int> order(receiver_count);
+  for (int i = 0; i < receiver_count; ++i) order[i] = i;
+  if (receiver_count > kMaxLinearPolymorphicMapCount) {
+    // Sort the entries by map address, see CodeStubAssembler::
+    // HandlePolymorphicCase.
+    std::sort(order.begin(), order.end(), [maps](int a, int b) {
+      return maps->at(a)->address() < maps->at(b)->address();
+    });
+  }
   for (int current = 0; current < receiver_count; ++current) {
-    Handle<Map> map = maps->at(current);
+    Handle<Map> map = maps->at(order[current]);
     Handle<WeakCell> cell = Map::WeakCellForMap(map);
     array->set(current * 2, *cell);
-    array->set(current * 2 + 1, *handlers->at(current));
+    array->set(current * 2 + 1, *handlers->at(order[current]));
   }
 }
 
@@ -631,6 +650,13 @@ int CallICNexus::ExtractCallCount() {
 void CallICNexus::Clear(Code* host) { CallIC::Clear(GetIsolate(), host, this); }
 
 
+void CallICNexus::ConfigureUninitialized() {
+  SetFeedback(*TypeFeedbackVector::UninitializedSentinel(GetIsolate()),
+              SKIP_WRITE_BARRIER);
+  SetFeedbackExtra(Smi::FromInt(0), SKIP_WRITE_BARRIER);
+}
+
+
 void CallICNexus::ConfigureMonomorphicArray() {
   Object* feedback = GetFeedback();
   if (!feedback->IsAllocationSite()) {
@@ -650,7 +676,8 @@ void CallICNexus::ConfigureMonomorphic(Handle<JSFunction> function) {
 
 
 void CallICNexus::ConfigureMegamorphic() {
-  FeedbackNexus::ConfigureMegamorphic();
+  // Preserve the call count, megamorphic CallICs keep counting calls.
+  ConfigureMegamorphic(Max(0, ExtractCallCount()));
 }
 
 
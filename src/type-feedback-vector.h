@@ -461,6 +461,7 @@ class CallICNexus final : public FeedbackNexus {
 
   void Clear(Code* host);
 
+  void ConfigureUninitialized() override;
   void ConfigureMonomorphicArray();
   void ConfigureMonomorphic(Handle<JSFunction> function);
   void ConfigureMegamorphic() final;
@@ -480,6 +481,8 @@ class CallICNexus final : public FeedbackNexus {
     return length == 0;
   }
 
+  // Returns the number of times the call site was hit, which is also
+  // tracked for megamorphic call sites, or -1 if it is not known.
   int ExtractCallCount();
 };
 
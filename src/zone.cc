@@ -6,6 +6,8 @@
 
 #include <cstring>
 
+#include "src/base/bits.h"
+#include "src/tracing/trace-event.h"
 #include "src/v8.h"
 
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -39,6 +41,14 @@ const size_t kASanRedzoneBytes = 0;
 
 #endif  // V8_USE_ADDRESS_SANITIZER
 
+void AccountZoneMemory(base::AccountingAllocator* allocator,
+                       base::AccountingAllocator::ZoneKind kind,
+                       intptr_t bytes) {
+  size_t current = allocator->AccountZoneMemory(kind, bytes);
+  TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("v8.zone_stats"),
+                 base::AccountingAllocator::ZoneKindToString(kind), current);
+}
+
 }  // namespace
 
 
@@ -78,6 +88,7 @@ Zone::Zone(base::AccountingAllocator* allocator)
       position_(0),
       limit_(0),
       allocator_(allocator),
+      kind_(base::AccountingAllocator::kOtherZone),
       segment_head_(nullptr) {}
 
 Zone::~Zone() {
@@ -88,6 +99,17 @@ Zone::~Zone() {
 }
 
 
+void Zone::set_kind(base::AccountingAllocator::ZoneKind kind) {
+  if (kind == kind_) return;
+  if (segment_bytes_allocated_ > 0) {
+    intptr_t bytes = static_cast<intptr_t>(segment_bytes_allocated_);
+    AccountZoneMemory(allocator_, kind_, -bytes);
+    AccountZoneMemory(allocator_, kind, bytes);
+  }
+  kind_ = kind;
+}
+
+
 void* Zone::New(size_t size) {
   // Round up the requested size to fit the alignment.
   size = RoundUp(size, kAlignment);
@@ -209,6 +231,7 @@ Segment* Zone::NewSegment(size_t size) {
     result->Initialize(segment_head_, size);
     segment_head_ = result;
   }
+  AccountZoneMemory(allocator_, kind_, static_cast<intptr_t>(size));
   return result;
 }
 
@@ -217,6 +240,7 @@ Segment* Zone::NewSegment(size_t size) {
 void Zone::DeleteSegment(Segment* segment, size_t size) {
   segment_bytes_allocated_ -= size;
   allocator_->Free(segment, size);
+  AccountZoneMemory(allocator_, kind_, -static_cast<intptr_t>(size));
 }
 
 
@@ -252,6 +276,12 @@ Address Zone::NewExpand(size_t size) {
     // All the while making sure to allocate a segment large enough to hold the
     // requested size.
     new_size = Max(min_new_size, kMaximumSegmentSize);
+  } else {
+    // Use power-of-two segment sizes where possible, so that segments freed
+    // by one zone can be recycled by the allocator's segment pool.
+    const size_t rounded_size = base::bits::RoundDownToPowerOfTwo32(
+        static_cast<uint32_t>(new_size));
+    new_size = Max(min_new_size, rounded_size);
   }
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory("Zone");
@@ -66,6 +66,12 @@ class Zone final {
 
   base::AccountingAllocator* allocator() const { return allocator_; }
 
+  // The kind of client the memory of this zone is attributed to in the
+  // allocator's statistics. Changing the kind moves the memory currently held
+  // by the zone over to the new kind.
+  base::AccountingAllocator::ZoneKind kind() const { return kind_; }
+  void set_kind(base::AccountingAllocator::ZoneKind kind);
+
  private:
   // All pointers returned from New() have this alignment.  In addition, if the
   // object being allocated has a size that is divisible by 8 then its alignment
@@ -117,6 +123,7 @@ class Zone final {
   Address limit_;
 
   base::AccountingAllocator* allocator_;
+  base::AccountingAllocator::ZoneKind kind_;
 
   Segment* segment_head_;
 };
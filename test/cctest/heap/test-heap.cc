@@ -39,6 +39,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/memory-reducer.h"
 #include "src/ic/ic.h"
+#include "src/interpreter/interpreter.h"
 #include "src/macro-assembler.h"
 #include "src/regexp/jsregexp.h"
 #include "src/snapshot/snapshot.h"
@@ -1394,6 +1395,153 @@ TEST(TestCodeFlushingPreAged) {
 }
 
 
+UNINITIALIZED_TEST(TestBytecodeFlushing) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code) return;
+  i::FLAG_ignition = true;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_always_opt = false;
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_optimize_for_size = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  isolate->Enter();
+  Factory* factory = i_isolate->factory();
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    // This compile will add the code to the compilation cache.
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    // Check function is compiled to bytecode.
+    Handle<Object> func_value = Object::GetProperty(i_isolate->global_object(),
+                                                    foo_name).ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->is_compiled());
+    CHECK(function->shared()->HasBytecodeArray());
+    int bytecode_size =
+        function->shared()->bytecode_array()->SizeIncludingMetadata();
+    intptr_t flushed_before = i_isolate->heap()->flushed_bytecode_size();
+
+    // The bytecode will survive at least two GCs.
+    i_isolate->heap()->CollectAllGarbage();
+    i_isolate->heap()->CollectAllGarbage();
+    CHECK(function->shared()->is_compiled());
+    CHECK(function->shared()->HasBytecodeArray());
+
+    // Simulate several GCs that use full marking.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      i_isolate->heap()->CollectAllGarbage();
+    }
+
+    // The bytecode should have been flushed and accounted for.
+    CHECK(!function->shared()->is_compiled());
+    CHECK(!function->shared()->HasBytecodeArray());
+    CHECK(!function->is_compiled());
+    CHECK_LE(flushed_before + bytecode_size,
+             i_isolate->heap()->flushed_bytecode_size());
+
+    // Call foo to get it recompiled.
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    CHECK(function->shared()->HasBytecodeArray());
+    CHECK(function->is_compiled());
+  }
+  isolate->Exit();
+  isolate->Dispose();
+}
+
+
+TEST(BytecodeAgingMarkingParity) {
+  CcTest::InitializeVM();
+  i::FLAG_ignition = true;
+  CcTest::i_isolate()->interpreter()->Initialize();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun("function foo() { return 42; }; foo();");
+  Handle<JSFunction> function = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(
+          CcTest::global()
+              ->Get(CcTest::isolate()->GetCurrentContext(), v8_str("foo"))
+              .ToLocalChecked())));
+  CHECK(function->shared()->HasBytecodeArray());
+  Handle<BytecodeArray> bytecode(function->shared()->bytecode_array());
+  bytecode->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
+
+  // Incremental marking can visit the bytecode twice in one marking phase, it
+  // must only age once.
+  bytecode->MakeOlder(ODD_MARKING_PARITY);
+  bytecode->MakeOlder(ODD_MARKING_PARITY);
+  CHECK_EQ(BytecodeArray::kQuadragenarianBytecodeAge, bytecode->bytecode_age());
+  bytecode->MakeOlder(EVEN_MARKING_PARITY);
+  CHECK_EQ(BytecodeArray::kQuinquagenarianBytecodeAge,
+           bytecode->bytecode_age());
+
+  // Calling the function resets the age.
+  CompileRun("foo();");
+  CHECK_EQ(BytecodeArray::kNoAgeBytecodeAge, bytecode->bytecode_age());
+  CHECK_EQ(NO_MARKING_PARITY, bytecode->bytecode_age_parity());
+}
+
+
+TEST(TestBytecodeFlushingEvictedByDebugInfo) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code) return;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  // The shared isolate is set up without an interpreter, initialize it after
+  // the fact.
+  i::FLAG_ignition = true;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->interpreter()->Initialize();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun("function foo() { var x = 42; return x; }; foo();");
+  Handle<JSFunction> function = Handle<JSFunction>::cast(
+      v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(
+          CcTest::global()
+              ->Get(CcTest::isolate()->GetCurrentContext(), v8_str("foo"))
+              .ToLocalChecked())));
+  Handle<SharedFunctionInfo> shared(function->shared());
+  CHECK(shared->HasBytecodeArray());
+  shared->bytecode_array()->set_bytecode_age(
+      BytecodeArray::kIsOldBytecodeAge);
+
+  // Incremental marking records foo as a bytecode flushing candidate and
+  // leaves its bytecode unmarked.
+  heap::SimulateIncrementalMarking(CcTest::heap());
+  CHECK(Marking::IsWhite(ObjectMarking::MarkBitFrom(shared->bytecode_array())));
+
+  // The debugger holds on to the original bytecode, so attaching a DebugInfo
+  // has to evict the candidate and mark its bytecode.
+  isolate->factory()->NewDebugInfo(shared);
+  CHECK(!Marking::IsWhite(
+      ObjectMarking::MarkBitFrom(shared->bytecode_array())));
+
+  CcTest::heap()->CollectAllGarbage();
+  CHECK(shared->HasBytecodeArray());
+  CHECK(shared->bytecode_array()->IsBytecodeArray());
+  CHECK_EQ(42, CompileRun("foo()")
+                   ->Int32Value(CcTest::isolate()->GetCurrentContext())
+                   .FromJust());
+}
+
+
 TEST(TestCodeFlushingIncremental) {
   // If we do not flush code this test is invalid.
   if (!FLAG_flush_code) return;
@@ -337,6 +337,7 @@ void ProgramOptions::PrintHeader(std::ostream& stream) const {  // NOLINT
 V8InitializationScope::V8InitializationScope(const char* exec_path)
     : platform_(v8::platform::CreateDefaultPlatform()) {
   i::FLAG_ignition = true;
+  i::FLAG_ignition_osr = false;  // Matches test-bytecode-generator.cc.
   i::FLAG_always_opt = false;
   i::FLAG_allow_natives_syntax = true;
 
@@ -29,6 +29,7 @@
 #include <csignal>
 #include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 
 #include "test/cctest/test-api.h"
@@ -21471,16 +21472,27 @@ TEST(ScopedMicrotasks) {
 namespace {
 
 int probes_counter = 0;
+int secondary_probes_counter = 0;
 int misses_counter = 0;
 int updates_counter = 0;
+int primary_collisions_counter = 0;
+int secondary_collisions_counter = 0;
 
 int* LookupCounter(const char* name) {
   if (strcmp(name, "c:V8.MegamorphicStubCacheProbes") == 0) {
     return &probes_counter;
+  } else if (strcmp(name, "c:V8.MegamorphicStubCacheSecondaryProbes") == 0) {
+    return &secondary_probes_counter;
   } else if (strcmp(name, "c:V8.MegamorphicStubCacheMisses") == 0) {
     return &misses_counter;
   } else if (strcmp(name, "c:V8.MegamorphicStubCacheUpdates") == 0) {
     return &updates_counter;
+  } else if (strcmp(name, "c:V8.MegamorphicStubCachePrimaryCollisions") ==
+             0) {
+    return &primary_collisions_counter;
+  } else if (strcmp(name, "c:V8.MegamorphicStubCacheSecondaryCollisions") ==
+             0) {
+    return &secondary_collisions_counter;
   }
   return NULL;
 }
@@ -21550,12 +21562,20 @@ void TestStubCache(bool primary) {
     }
 
     int initial_probes = probes_counter;
+    int initial_secondary_probes = secondary_probes_counter;
     int initial_misses = misses_counter;
     int initial_updates = updates_counter;
+    int initial_primary_collisions = primary_collisions_counter;
+    int initial_secondary_collisions = secondary_collisions_counter;
     CompileRun(kMegamorphicTestProgram);
     int probes = probes_counter - initial_probes;
+    int secondary_probes = secondary_probes_counter - initial_secondary_probes;
     int misses = misses_counter - initial_misses;
     int updates = updates_counter - initial_updates;
+    int primary_collisions =
+        primary_collisions_counter - initial_primary_collisions;
+    int secondary_collisions =
+        secondary_collisions_counter - initial_secondary_collisions;
     const int kClassesCount = 50;
     const int kIterationsCount = 1000;
     CHECK_LE(kClassesCount, updates);
@@ -21565,6 +21585,13 @@ void TestStubCache(bool primary) {
     CHECK_LE(updates, kClassesCount * 2);
     CHECK_LE(1, misses);
     CHECK_LE(misses, kClassesCount * 2);
+    // Every collision is caused by an update, and only entries retired from
+    // the primary table can collide in the secondary table.
+    CHECK_LE(primary_collisions, updates);
+    CHECK_LE(secondary_collisions, primary_collisions);
+    // The program has no Smi receivers, so every miss probed both tables.
+    CHECK_LE(misses, secondary_probes);
+    CHECK_LE(secondary_probes, probes);
     // 2 is for PREMONOMORPHIC and MONOMORPHIC states,
     // 4 is for POLYMORPHIC states,
     // and all the others probes are for MEGAMORPHIC state.
@@ -24644,6 +24671,68 @@ TEST(StreamingScriptWithSourceMappingURLInTheMiddle) {
 }
 
 
+
+TEST(StreamingScriptsInParallel) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::TryCatch try_catch(isolate);
+
+  static const int kScriptCount = 8;
+  std::string sources[kScriptCount];
+  std::unique_ptr<v8::ScriptCompiler::StreamedSource> streamed[kScriptCount];
+  v8::ScriptCompiler::StreamedSource* streamed_ptrs[kScriptCount];
+  for (int i = 0; i < kScriptCount; i++) {
+    // Make the sources big enough to span several chunks.
+    std::ostringstream source;
+    source << "var result" << i << " = 0;\n";
+    for (int j = 0; j < 2000; j++) {
+      source << "function f" << i << "_" << j << "(a) { return a + " << j
+             << "; }\n";
+    }
+    source << "result" << i << " = f" << i << "_1999(" << i << ");\n";
+    sources[i] = source.str();
+    streamed[i].reset(new v8::ScriptCompiler::StreamedSource(
+        reinterpret_cast<const uint8_t*>(sources[i].data()),
+        sources[i].length(),
+        i % 2 == 0 ? v8::ScriptCompiler::StreamedSource::ONE_BYTE
+                   : v8::ScriptCompiler::StreamedSource::UTF8));
+    streamed_ptrs[i] = streamed[i].get();
+  }
+
+  v8::ScriptCompiler::StartStreamingScripts(isolate, streamed_ptrs,
+                                            kScriptCount);
+
+  // Compile in reverse order, which waits for each script's background work.
+  for (int i = kScriptCount - 1; i >= 0; i--) {
+    v8::ScriptOrigin origin(v8_str("http://foo.com"));
+    v8::Local<Script> script =
+        v8::ScriptCompiler::Compile(env.local(), streamed[i].get(),
+                                    v8_str(sources[i].c_str()), origin)
+            .ToLocalChecked();
+    script->Run(env.local()).ToLocalChecked();
+  }
+  CHECK(!try_catch.HasCaught());
+  for (int i = 0; i < kScriptCount; i++) {
+    std::ostringstream name;
+    name << "result" << i;
+    CHECK_EQ(1999 + i, CompileRun(name.str().c_str())
+                           ->Int32Value(env.local())
+                           .FromJust());
+  }
+
+  // Sources that are destroyed without being compiled wait for their
+  // background work as well.
+  std::string unused = "function unused() { return 13; }";
+  {
+    v8::ScriptCompiler::StreamedSource source(
+        reinterpret_cast<const uint8_t*>(unused.data()), unused.length(),
+        v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+    v8::ScriptCompiler::StreamedSource* source_ptr = &source;
+    v8::ScriptCompiler::StartStreamingScripts(isolate, &source_ptr, 1);
+  }
+}
+
 TEST(NewStringRangeError) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope handle_scope(isolate);
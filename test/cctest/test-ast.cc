@@ -58,3 +58,42 @@ TEST(List) {
   CHECK_EQ(0, list->length());
   delete list;
 }
+
+TEST(SmiLiteralsShareValues) {
+  v8::base::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  AstValueFactory value_factory(&zone, 0);
+  AstNodeFactory factory(&value_factory);
+
+  Literal* one = factory.NewSmiLiteral(1, kNoSourcePosition);
+  Literal* other_one = factory.NewSmiLiteral(1, kNoSourcePosition);
+  CHECK_NE(one, other_one);
+  CHECK_EQ(one->raw_value(), other_one->raw_value());
+
+  // Only small values are shared.
+  const int kLarge = 1 << 20;
+  CHECK_NE(factory.NewSmiLiteral(kLarge, kNoSourcePosition)->raw_value(),
+           factory.NewSmiLiteral(kLarge, kNoSourcePosition)->raw_value());
+}
+
+TEST(NodeFlagsKeepNodeType) {
+  v8::base::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  AstValueFactory value_factory(&zone, 0);
+  AstNodeFactory factory(&value_factory);
+  Literal* one = factory.NewSmiLiteral(1, kNoSourcePosition);
+
+  Property* property = factory.NewProperty(one, one, kNoSourcePosition);
+  property->mark_for_call();
+  property->set_inline_cache_state(MEGAMORPHIC);
+  CHECK(property->IsProperty());
+  CHECK(property->is_for_call());
+  CHECK_EQ(MEGAMORPHIC, property->GetInlineCacheState());
+
+  BinaryOperation* operation =
+      factory.NewBinaryOperation(Token::SHL, one, one, kNoSourcePosition);
+  operation->set_fixed_right_arg(v8::Just(3));
+  CHECK(operation->IsBinaryOperation());
+  CHECK_EQ(Token::SHL, operation->op());
+  CHECK_EQ(3, operation->fixed_right_arg().FromJust());
+}
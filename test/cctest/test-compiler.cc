@@ -841,3 +841,190 @@ TEST(IgnitionEntryTrampolineSelfHealing) {
   CHECK_NE(*isolate->builtins()->InterpreterEntryTrampoline(), f2->code());
   CHECK_EQ(23.0, GetGlobalProperty("result2")->Number());
 }
+
+namespace {
+
+int function_compilation_event_count = 0;
+int optimized_compilation_event_count = 0;
+std::string optimized_compiler;
+std::vector<std::string> inlined_function_names;
+
+void FunctionCompilationEventHandler(
+    v8::Isolate* isolate, const v8::FunctionCompilationEvent* event) {
+  CHECK_NOT_NULL(event->compiler);
+  CHECK_LT(0u, event->code_size);
+  CHECK_LE(0.0, event->prepare_time_ms);
+  CHECK_LE(0.0, event->execute_time_ms);
+  CHECK_LE(0.0, event->finalize_time_ms);
+  CHECK_EQ(event->phase_count == 0, event->phases == nullptr);
+  CHECK_EQ(event->inlined_function_count == 0,
+           event->inlined_functions == nullptr);
+  function_compilation_event_count++;
+
+  std::string name(event->name.str, event->name.len);
+  if (name != "outer") return;
+  optimized_compiler = event->compiler;
+  for (size_t i = 0; i < event->inlined_function_count; ++i) {
+    inlined_function_names.push_back(std::string(
+        event->inlined_functions[i].str, event->inlined_functions[i].len));
+  }
+  if (strcmp(event->compiler, "TurboFan") == 0) {
+    CHECK_LT(0u, event->phase_count);
+    for (size_t i = 0; i < event->phase_count; ++i) {
+      CHECK_NOT_NULL(event->phases[i].name);
+      CHECK_LE(0.0, event->phases[i].time_ms);
+    }
+    CHECK_LT(0u, event->max_allocated_bytes);
+    optimized_compilation_event_count++;
+  } else if (strcmp(event->compiler, "Crankshaft") == 0) {
+    optimized_compilation_event_count++;
+  }
+}
+
+}  // namespace
+
+TEST(FunctionCompilationEventHandler) {
+  if (!i::FLAG_crankshaft && !i::FLAG_turbo) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CcTest::isolate()->SetFunctionCompilationEventHandler(
+      FunctionCompilationEventHandler);
+
+  CompileRun(
+      "function inner(x) { return x + 1; }"
+      "function outer(x) { return inner(x) * 2; }"
+      "outer(1); outer(2);"
+      "%OptimizeFunctionOnNextCall(outer);"
+      "outer(3);");
+  CHECK_LT(0, function_compilation_event_count);
+  CHECK_EQ(1, optimized_compilation_event_count);
+  bool inlining_enabled = optimized_compiler == "TurboFan"
+                              ? i::FLAG_turbo_inlining
+                              : i::FLAG_use_inlining;
+  if (inlining_enabled) {
+    CHECK_EQ(1u, inlined_function_names.size());
+    CHECK_EQ(std::string("inner"), inlined_function_names[0]);
+  }
+
+  // No events are reported once the handler has been removed.
+  CcTest::isolate()->SetFunctionCompilationEventHandler(nullptr);
+  int count = function_compilation_event_count;
+  CompileRun("function later() { return 42; } later();");
+  CHECK_EQ(count, function_compilation_event_count);
+}
+
+namespace {
+
+v8::CompilationCacheStatistics GetScriptCacheStatistics() {
+  v8::CompilationCacheStatistics statistics;
+  CHECK(CcTest::isolate()->GetCompilationCacheStatistics(&statistics, 0));
+  CHECK_EQ(0, strcmp("script", statistics.cache_name()));
+  return statistics;
+}
+
+void CompileRunPaddedScript(int index) {
+  EmbeddedVector<char, 256> source;
+  SNPrintF(source, "var padded%d = '%0150d';", index, index);
+  CompileRun(source.start());
+}
+
+}  // namespace
+
+TEST(CompilationCacheStatistics) {
+  FLAG_compilation_cache_size = 16;  // 16 KB per sub-cache.
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CHECK_EQ(4u, CcTest::isolate()->NumberOfCompilationCaches());
+  v8::CompilationCacheStatistics statistics;
+  CHECK(!CcTest::isolate()->GetCompilationCacheStatistics(&statistics, 4));
+
+  v8::CompilationCacheStatistics before = GetScriptCacheStatistics();
+  CompileRun("var first = 1;");
+  CompileRun("var first = 1;");
+  v8::CompilationCacheStatistics after = GetScriptCacheStatistics();
+  CHECK_EQ(before.misses() + 1, after.misses());
+  CHECK_EQ(before.hits() + 1, after.hits());
+  CHECK_LT(0u, after.cache_size());
+
+  // Fill the cache beyond its budget.
+  const int kScripts = 200;
+  for (int i = 0; i < kScripts; i++) CompileRunPaddedScript(i);
+  after = GetScriptCacheStatistics();
+  CHECK_LT(0u, after.evictions());
+  CHECK_LE(after.cache_size(), static_cast<size_t>(16 * KB));
+
+  // Entries are not aged out by garbage collections, but the least recently
+  // used ones are evicted first.
+  CcTest::heap()->CollectAllGarbage();
+  before = GetScriptCacheStatistics();
+  CompileRunPaddedScript(kScripts - 1);
+  after = GetScriptCacheStatistics();
+  CHECK_EQ(before.hits() + 1, after.hits());
+  CompileRun("var first = 1;");
+  CHECK_EQ(after.misses() + 1, GetScriptCacheStatistics().misses());
+}
+
+TEST(LazySourcePositions) {
+  FLAG_always_opt = false;
+  FLAG_lazy_source_positions = true;
+  CcTest::InitializeVM();
+  FLAG_ignition = true;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->interpreter()->Initialize();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun(
+      "function outer() {\n"
+      "  return function f(x) {\n"
+      "    if (x) return new Error('boom');\n"
+      "    return 23;\n"
+      "  };\n"
+      "}\n"
+      "var f = outer();\n"
+      "f(false);\n");
+  Handle<JSFunction> f = Handle<JSFunction>::cast(GetGlobalProperty("f"));
+  CHECK(f->shared()->HasBytecodeArray());
+  CHECK_EQ(0, f->shared()->bytecode_array()->source_position_table()->length());
+
+  // Constructing an error does not collect the source positions yet.
+  CompileRun("var e = f(true);");
+  CHECK_EQ(0, f->shared()->bytecode_array()->source_position_table()->length());
+
+  // Formatting its stack trace does.
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  v8::Local<v8::String> stack =
+      CompileRun("e.stack")->ToString(context).ToLocalChecked();
+  v8::String::Utf8Value stack_utf8(stack);
+  CHECK(strstr(*stack_utf8, "at f (") != NULL);
+  CHECK(strstr(*stack_utf8, ":3:") != NULL);
+  CHECK_LT(0, f->shared()->bytecode_array()->source_position_table()->length());
+}
+
+TEST(LazySourcePositionsStackOverflow) {
+  FLAG_always_opt = false;
+  FLAG_lazy_source_positions = true;
+  CcTest::InitializeVM();
+  FLAG_ignition = true;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->interpreter()->Initialize();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // Capturing the stack trace of the RangeError must not overflow again
+  // while collecting the positions of g.
+  v8::TryCatch try_catch(CcTest::isolate());
+  CompileRun(
+      "function outer() {\n"
+      "  return function g() { return g() + 1; };\n"
+      "}\n"
+      "outer()();\n");
+  CHECK(try_catch.HasCaught());
+  v8::Local<v8::Context> context = CcTest::isolate()->GetCurrentContext();
+  CHECK(try_catch.Exception()
+            ->ToString(context)
+            .ToLocalChecked()
+            ->Equals(context, v8_str("RangeError: Maximum call stack size "
+                                     "exceeded"))
+            .FromJust());
+}
@@ -932,3 +932,111 @@ UNINITIALIZED_TEST(DeoptimizeLoadICStoreICNested) {
   isolate->Exit();
   isolate->Dispose();
 }
+
+
+static int deoptimization_event_count = 0;
+static v8::DeoptimizationEvent last_deoptimization_event;
+static std::string last_deoptimization_event_name;
+
+
+static void DeoptimizationEventHandler(v8::Isolate* isolate,
+                                       const v8::DeoptimizationEvent* event) {
+  deoptimization_event_count++;
+  last_deoptimization_event = *event;
+  last_deoptimization_event_name.assign(event->name.str, event->name.len);
+  last_deoptimization_event.name.str = nullptr;
+}
+
+
+static void RunEagerDeoptimization(LocalContext* env) {
+  AllowNativesSyntaxNoInlining options;
+  CompileRun(
+      "function f(o) { return o.a; };"
+      "f({a: 1});"
+      "f({a: 2});"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({a: 3});"
+      "f({b: 1, a: 2});");
+  CHECK(!GetJSFunction(env->local(), "f")->IsOptimized());
+}
+
+
+TEST(DeoptimizationEventHandler) {
+  i::FLAG_always_opt = false;
+  i::FLAG_concurrent_recompilation = false;
+  i::FLAG_deopt_loop_threshold = 0;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  env->GetIsolate()->SetDeoptimizationEventHandler(DeoptimizationEventHandler);
+  deoptimization_event_count = 0;
+
+  RunEagerDeoptimization(&env);
+
+  CHECK_EQ(1, deoptimization_event_count);
+  CHECK_EQ(v8::DeoptimizationEvent::EAGER, last_deoptimization_event.type);
+  CHECK_EQ(0, strcmp("f", last_deoptimization_event_name.c_str()));
+  CHECK_NOT_NULL(last_deoptimization_event.reason);
+  CHECK(!last_deoptimization_event.optimization_disabled);
+  Handle<JSFunction> f = GetJSFunction(env.local(), "f");
+  CHECK(!f->shared()->optimization_disabled());
+  CHECK_EQ(1, f->shared()->deopt_count());
+
+  env->GetIsolate()->SetDeoptimizationEventHandler(nullptr);
+}
+
+
+TEST(DeoptimizationLoopDisablesOptimization) {
+  i::FLAG_always_opt = false;
+  i::FLAG_concurrent_recompilation = false;
+  i::FLAG_deopt_loop_threshold = 1;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  env->GetIsolate()->SetDeoptimizationEventHandler(DeoptimizationEventHandler);
+  deoptimization_event_count = 0;
+
+  RunEagerDeoptimization(&env);
+
+  CHECK_EQ(1, deoptimization_event_count);
+  CHECK(last_deoptimization_event.optimization_disabled);
+  Handle<JSFunction> f = GetJSFunction(env.local(), "f");
+  CHECK(f->shared()->optimization_disabled());
+  CHECK_EQ(i::kDeoptimizationLoop,
+           f->shared()->disable_optimization_reason());
+
+  env->GetIsolate()->SetDeoptimizationEventHandler(nullptr);
+}
+
+
+TEST(DeoptimizationLoopRequiresEagerDeoptsInARow) {
+  i::FLAG_always_opt = false;
+  i::FLAG_concurrent_recompilation = false;
+  i::FLAG_deopt_loop_threshold = 2;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  env->GetIsolate()->SetDeoptimizationEventHandler(DeoptimizationEventHandler);
+  deoptimization_event_count = 0;
+
+  RunEagerDeoptimization(&env);
+
+  Handle<JSFunction> f = GetJSFunction(env.local(), "f");
+  CHECK_EQ(1, f->shared()->deopt_loop_count());
+  CHECK(!f->shared()->optimization_disabled());
+  CHECK(!last_deoptimization_event.optimization_disabled);
+
+  // A second eager deoptimization of the reoptimized code is a loop.
+  {
+    AllowNativesSyntaxNoInlining options;
+    CompileRun(
+        "%OptimizeFunctionOnNextCall(f);"
+        "f({a: 3});"
+        "f({c: 1, a: 2});");
+  }
+  CHECK(!f->IsOptimized());
+  CHECK_EQ(2, deoptimization_event_count);
+  CHECK(last_deoptimization_event.optimization_disabled);
+  CHECK(f->shared()->optimization_disabled());
+  CHECK_EQ(i::kDeoptimizationLoop,
+           f->shared()->disable_optimization_reason());
+
+  env->GetIsolate()->SetDeoptimizationEventHandler(nullptr);
+}
@@ -275,6 +275,34 @@ TEST(VectorCallCounts) {
   CHECK_EQ(3, nexus.ExtractCallCount());
 }
 
+TEST(VectorMegamorphicCallCounts) {
+  if (i::FLAG_always_opt) return;
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  // Make sure function f has a call that uses a type feedback slot.
+  CompileRun(
+      "function foo() { return 17; }"
+      "function bar() { return 19; }"
+      "function f(a) { a(); } f(foo); f(bar);");
+  Handle<JSFunction> f = GetFunction("f");
+  // There should be one IC.
+  Handle<TypeFeedbackVector> feedback_vector =
+      Handle<TypeFeedbackVector>(f->feedback_vector(), isolate);
+  FeedbackVectorSlot slot(0);
+  CallICNexus nexus(feedback_vector, slot);
+  CHECK_EQ(GENERIC, nexus.StateFromFeedback());
+  int calls = nexus.ExtractCallCount();
+  CHECK_LE(1, calls);
+
+  // Megamorphic call sites keep counting calls.
+  CompileRun("f(foo); f(bar);");
+  CHECK_EQ(GENERIC, nexus.StateFromFeedback());
+  CHECK_EQ(calls + 2, nexus.ExtractCallCount());
+}
+
 TEST(VectorConstructCounts) {
   if (i::FLAG_always_opt) return;
   CcTest::InitializeVM();
@@ -352,6 +380,87 @@ TEST(VectorLoadICStates) {
   CHECK_EQ(MEGAMORPHIC, nexus.StateFromFeedback());
 }
 
+TEST(VectorLoadICWidePolymorphism) {
+  if (i::FLAG_always_opt) return;
+  FLAG_max_polymorphic_map_count = 8;
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "function f(a) { return a.foo; }"
+      "function make(i) {"
+      "  var o = { foo: 1 };"
+      "  o['p' + i] = i;"
+      "  return o;"
+      "}"
+      "f(make(0));"
+      "for (var i = 0; i < 8; i++) f(make(i));");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<TypeFeedbackVector> feedback_vector =
+      Handle<TypeFeedbackVector>(f->feedback_vector(), isolate);
+  FeedbackVectorSlot slot(0);
+  LoadICNexus nexus(feedback_vector, slot);
+  CHECK_EQ(POLYMORPHIC, nexus.StateFromFeedback());
+  MapHandleList maps;
+  nexus.FindAllMaps(&maps);
+  CHECK_EQ(8, maps.length());
+  // Wide polymorphic feedback is sorted by map address, so that the IC stub
+  // can binary search it.
+  for (int i = 1; i < maps.length(); i++) {
+    CHECK(maps.at(i - 1)->address() < maps.at(i)->address());
+  }
+  CHECK_EQ(8, CompileRun("var sum = 0;"
+                         "for (var i = 0; i < 8; i++) sum += f(make(i));"
+                         "sum")
+                  ->Int32Value(context.local())
+                  .FromJust());
+  CHECK_EQ(POLYMORPHIC, nexus.StateFromFeedback());
+
+  // One more map exceeds the configured limit.
+  CompileRun("f(make(8))");
+  CHECK_EQ(MEGAMORPHIC, nexus.StateFromFeedback());
+}
+
+
+TEST(LazyFeedbackVectorAllocation) {
+  if (i::FLAG_always_opt) return;
+  i::FLAG_lazy_feedback_allocation = true;
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  CompileRun(
+      "function f(o) { return o.foo; }"
+      "f({ foo: 1 });");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<SharedFunctionInfo> shared(f->shared(), isolate);
+  CHECK(shared->is_compiled());
+  CHECK(!f->feedback_vector()->is_empty());
+
+  // Instantiating the compiled function in a fresh native context must not
+  // allocate literals or a feedback vector until the closure is invoked.
+  v8::Local<v8::Context> other = v8::Context::New(context->GetIsolate());
+  Handle<Context> other_context = v8::Utils::OpenHandle(*other);
+  Handle<JSFunction> g =
+      factory->NewFunctionFromSharedFunctionInfo(shared, other_context);
+  CHECK_EQ(isolate->heap()->empty_literals_array(), g->literals());
+  CHECK(!g->is_compiled());
+  CHECK(g->shared()->is_compiled());
+
+  Handle<Object> args[] = {handle(Smi::FromInt(1), isolate)};
+  Execution::Call(isolate, g, factory->undefined_value(), arraysize(args),
+                  args)
+      .ToHandleChecked();
+  CHECK(g->is_compiled());
+  CHECK_NE(isolate->heap()->empty_literals_array(), g->literals());
+  CHECK(!g->feedback_vector()->is_empty());
+  CHECK_NE(f->feedback_vector(), g->feedback_vector());
+}
+
 
 TEST(VectorLoadICSlotSharing) {
   if (i::FLAG_always_opt) return;
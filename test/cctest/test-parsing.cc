@@ -728,6 +728,72 @@ TEST(CharacterStreams) {
 }
 
 
+// Hands out a UTF-8 source in chunks of a fixed size.
+class ChunkedSourceStream : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  ChunkedSourceStream(const std::string& data, size_t chunk_size)
+      : data_(data), chunk_size_(chunk_size), offset_(0) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    size_t length = std::min(chunk_size_, data_.size() - offset_);
+    if (length == 0) return 0;
+    // The caller takes ownership of the chunk.
+    uint8_t* chunk = new uint8_t[length];
+    memcpy(chunk, data_.data() + offset_, length);
+    offset_ += length;
+    *src = chunk;
+    return length;
+  }
+
+ private:
+  std::string data_;
+  size_t chunk_size_;
+  size_t offset_;
+};
+
+
+TEST(Utf8StreamingCharacterStream) {
+  // Long ASCII runs interleaved with two-, three- and four-byte sequences, so
+  // that both the bulk ASCII path and the decoder cross buffer and chunk
+  // boundaries.
+  std::string utf8;
+  std::vector<i::uc16> expected;
+  for (int i = 0; i < 200; i++) {
+    for (int j = 0; j < i * 7 % 600; j++) {
+      char c = static_cast<char>('a' + (i + j) % 26);
+      utf8 += c;
+      expected.push_back(c);
+    }
+    switch (i % 3) {
+      case 0:
+        utf8 += "\xc3\xa4";  // U+00E4
+        expected.push_back(0xe4);
+        break;
+      case 1:
+        utf8 += "\xe2\x82\xac";  // U+20AC
+        expected.push_back(0x20ac);
+        break;
+      case 2:
+        utf8 += "\xf0\x9f\x98\x80";  // U+1F600
+        expected.push_back(0xd83d);
+        expected.push_back(0xde00);
+        break;
+    }
+  }
+
+  static const size_t kChunkSizes[] = {7, 64, 509, 4096, 1 << 20};
+  for (size_t chunk_size : kChunkSizes) {
+    ChunkedSourceStream source(utf8, chunk_size);
+    i::ExternalStreamingStream stream(
+        &source, v8::ScriptCompiler::StreamedSource::UTF8);
+    for (size_t i = 0; i < expected.size(); i++) {
+      CHECK_EQ(static_cast<int32_t>(expected[i]), stream.Advance());
+    }
+    CHECK_LT(stream.Advance(), 0);
+  }
+}
+
+
 void TestStreamScanner(i::Utf16CharacterStream* stream,
                        i::Token::Value* expected_tokens,
                        int skip_pos = 0,  // Zero means not skipping.
@@ -806,6 +872,53 @@ TEST(StreamScanner) {
 }
 
 
+TEST(ScanLongTokens) {
+  v8::V8::Initialize();
+  // Runs that are longer than the character stream buffers, so that the
+  // bulk scanning loops have to resume after the buffer has been refilled.
+  static const int kRunLength = 3000;
+  std::string identifier;
+  std::string comment;
+  std::string string_body;
+  for (int i = 0; i < kRunLength; i++) {
+    identifier += "aZ9_$"[i % 5];
+    comment += "ab* /"[i % 5];  // No "*/".
+    string_body += "x y\tz"[i % 5];
+  }
+  std::string source = std::string(kRunLength, ' ') + "\t" + identifier +
+                       " // " + comment + "\n/* " + comment + " */ '" +
+                       string_body + "'";
+
+  i::ExternalOneByteStringUtf16CharacterStream stream(source.c_str(),
+                                                      source.length());
+  i::Scanner scanner(CcTest::i_isolate()->unicode_cache());
+  scanner.Initialize(&stream);
+  i::Zone zone(CcTest::i_isolate()->allocator());
+  i::AstValueFactory ast_value_factory(&zone,
+                                       CcTest::i_isolate()->heap()->HashSeed());
+
+  CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+  CHECK_EQ(kRunLength + 1, scanner.location().beg_pos);
+  const i::AstRawString* literal = scanner.CurrentSymbol(&ast_value_factory);
+  CHECK(literal->is_one_byte());
+  CHECK_EQ(identifier,
+           std::string(reinterpret_cast<const char*>(literal->raw_data()),
+                       literal->length()));
+  // The single-line comment ends in a line terminator.
+  CHECK(scanner.HasAnyLineTerminatorBeforeNext());
+
+  CHECK_EQ(i::Token::STRING, scanner.Next());
+  literal = scanner.CurrentSymbol(&ast_value_factory);
+  CHECK(literal->is_one_byte());
+  CHECK_EQ(string_body,
+           std::string(reinterpret_cast<const char*>(literal->raw_data()),
+                       literal->length()));
+  CHECK_EQ(static_cast<int>(source.length()), scanner.location().end_pos);
+
+  CHECK_EQ(i::Token::EOS, scanner.Next());
+}
+
+
 void TestScanRegExp(const char* re_source, const char* expected) {
   i::ExternalOneByteStringUtf16CharacterStream stream(re_source);
   i::HandleScope scope(CcTest::i_isolate());
@@ -29,12 +29,17 @@
 
 #include <sys/stat.h>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "src/v8.h"
 
 #include "src/bootstrapper.h"
 #include "src/compilation-cache.h"
 #include "src/compiler.h"
 #include "src/debug/debug.h"
+#include "src/full-codegen/full-codegen.h"
 #include "src/heap/spaces.h"
 #include "src/macro-assembler.h"
 #include "src/objects.h"
@@ -1560,6 +1565,439 @@ TEST(CodeSerializerFlagChange) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerPreparseData) {
+  FLAG_serialize_toplevel = true;
+  FLAG_serialize_preparse_data = true;
+  FLAG_min_preparse_length = 0;
+
+  const char* source =
+      "function f() { return 'abc'; }; function g() { return 'def'; }; "
+      "f() + g()";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  {
+    // The embedded preparse data is only handed out for the original source.
+    Isolate* isolate = CcTest::i_isolate();
+    HandleScope scope(isolate);
+    ScriptData script_data(cache->data, cache->length);
+    Handle<String> source_string =
+        isolate->factory()->NewStringFromAsciiChecked(source);
+    std::unique_ptr<ScriptData> preparse_data(
+        SerializedCodeData::ExtractPreparseData(&script_data, source_string));
+    CHECK_NOT_NULL(preparse_data.get());
+    std::unique_ptr<ParseData> parse_data(
+        ParseData::FromCachedData(preparse_data.get()));
+    CHECK_NOT_NULL(parse_data.get());
+    CHECK_EQ(2, parse_data->FunctionCount());
+
+    // Same length, different content.
+    std::string edited(source);
+    edited[edited.find("abc")] = 'x';
+    Handle<String> edited_string =
+        isolate->factory()->NewStringFromAsciiChecked(edited.c_str());
+    CHECK_NULL(
+        SerializedCodeData::ExtractPreparseData(&script_data, edited_string));
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+
+  FLAG_allow_natives_syntax = true;  // Flag change should trigger cache reject.
+  FlagList::EnforceFlagImplications();
+  {
+    // Preparse data recorded with other flags is dropped as well.
+    Isolate* isolate = CcTest::i_isolate();
+    HandleScope scope(isolate);
+    ScriptData script_data(cache->data, cache->length);
+    Handle<String> source_string =
+        isolate->factory()->NewStringFromAsciiChecked(source);
+    CHECK_NULL(
+        SerializedCodeData::ExtractPreparseData(&script_data, source_string));
+  }
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    // The cached code is rejected, but the script still compiles correctly.
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(cache->rejected);
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+static int preparse_histogram_samples = 0;
+
+static void* CreatePreparseHistogram(const char* name, int min, int max,
+                                     size_t buckets) {
+  if (strcmp(name, "V8.PreParseMicroSeconds") != 0) return nullptr;
+  return &preparse_histogram_samples;
+}
+
+static void AddPreparseHistogramSample(void* histogram, int sample) {
+  (*static_cast<int*>(histogram))++;
+}
+
+TEST(CodeSerializerConsumePreparseData) {
+  FLAG_serialize_toplevel = true;
+  FLAG_serialize_preparse_data = true;
+  FLAG_min_preparse_length = 0;
+
+  const char* source =
+      "function f() { return 'abc'; }; function g() { return 'def'; }; "
+      "f() + g()";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  // Flip a bit in the payload checksum (header entry 8), so that the cached
+  // code is rejected. The preparse data has its own checksum.
+  const_cast<uint8_t*>(cache->data)[8 * kInt32Size] ^= 0x01;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.create_histogram_callback = CreatePreparseHistogram;
+  create_params.add_histogram_sample_callback = AddPreparseHistogramSample;
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    // Without preparse data, lazy functions are preparsed.
+    preparse_histogram_samples = 0;
+    CompileRun("function h() { return 'ghi'; }; h()");
+    CHECK_LT(0, preparse_histogram_samples);
+
+    // With the embedded preparse data, they are skipped without preparsing.
+    preparse_histogram_samples = 0;
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(cache->rejected);
+    CHECK_EQ(0, preparse_histogram_samples);
+
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerAfterExecution) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* initial_cache;
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate1, &source, v8::ScriptCompiler::kProduceCodeCache)
+            .ToLocalChecked();
+    const v8::ScriptCompiler::CachedData* data = source.GetCachedData();
+    CHECK(data);
+    uint8_t* buffer = NewArray<uint8_t>(data->length);
+    MemCopy(buffer, data->data, data->length);
+    initial_cache = new v8::ScriptCompiler::CachedData(
+        buffer, data->length, v8::ScriptCompiler::CachedData::BufferOwned);
+
+    // Running the script compiles f lazily.
+    script->BindToCurrentContext()
+        ->Run(isolate1->GetCurrentContext())
+        .ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*context->Global()
+                                   ->Get(context, v8_str("f"))
+                                   .ToLocalChecked()));
+    Handle<Code> f_code(f->shared()->code());
+    cache = v8::ScriptCompiler::CreateCodeCache(script, source_str);
+    CHECK(cache);
+    // Creating the cache leaves the code in use untouched.
+    CHECK_EQ(*f_code, f->shared()->code());
+  }
+  isolate1->Dispose();
+  CHECK_GT(cache->length, initial_cache->length);
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::Value> result;
+    {
+      // Neither the script nor f need to be compiled.
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      v8::Local<v8::UnboundScript> script =
+          v8::ScriptCompiler::CompileUnboundScript(
+              isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+              .ToLocalChecked();
+      CHECK(!cache->rejected);
+      result = script->BindToCurrentContext()
+                   ->Run(isolate2->GetCurrentContext())
+                   .ToLocalChecked();
+    }
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+  delete initial_cache;
+}
+
+TEST(CodeSerializerAfterExecutionResetsTieringState) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source =
+      "function f() { for (var i = 0; i < 3; i++) {} return 'abc'; }; "
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate1, &source, v8::ScriptCompiler::kProduceCodeCache)
+            .ToLocalChecked();
+    script->BindToCurrentContext()
+        ->Run(isolate1->GetCurrentContext())
+        .ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*context->Global()
+                                   ->Get(context, v8_str("f"))
+                                   .ToLocalChecked()));
+    Handle<SharedFunctionInfo> shared(f->shared());
+
+    // Pretend that f was optimized and deoptimized a lot, and is hot.
+    shared->DisableOptimization(kOptimizedTooManyTimes);
+    shared->set_opt_count(3);
+    shared->increment_deopt_count();
+    shared->increment_deopt_loop_count();
+    shared->set_profiler_ticks(2);
+    if (shared->HasBytecodeArray()) {
+      shared->bytecode_array()->set_osr_loop_nesting_level(1);
+      shared->bytecode_array()->set_bytecode_age(
+          BytecodeArray::kIsOldBytecodeAge);
+    } else {
+      BackEdgeTable::Patch(reinterpret_cast<Isolate*>(isolate1),
+                           shared->code());
+      shared->code()->set_profiler_ticks(2);
+    }
+
+    cache = v8::ScriptCompiler::CreateCodeCache(script, source_str);
+    CHECK(cache);
+
+    // The running script keeps its state.
+    CHECK(shared->optimization_disabled());
+    CHECK_EQ(kOptimizedTooManyTimes, shared->disable_optimization_reason());
+    CHECK_EQ(3, shared->opt_count());
+    CHECK_EQ(1, shared->deopt_count());
+    CHECK_EQ(1, shared->deopt_loop_count());
+    CHECK_EQ(2, shared->profiler_ticks());
+    if (shared->HasBytecodeArray()) {
+      CHECK_EQ(1, shared->bytecode_array()->osr_loop_nesting_level());
+      CHECK_EQ(BytecodeArray::kIsOldBytecodeAge,
+               shared->bytecode_array()->bytecode_age());
+    } else {
+      CHECK_EQ(1, shared->code()->allow_osr_at_loop_nesting_level());
+      CHECK_EQ(2, shared->code()->profiler_ticks());
+    }
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()
+        ->Run(isolate2->GetCurrentContext())
+        .ToLocalChecked();
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*context->Global()
+                                   ->Get(context, v8_str("f"))
+                                   .ToLocalChecked()));
+    Handle<SharedFunctionInfo> shared(f->shared());
+
+    // The deserialized function starts out like a freshly compiled one.
+    CHECK(!shared->optimization_disabled());
+    CHECK_EQ(kNoReason, shared->disable_optimization_reason());
+    CHECK_EQ(0, shared->opt_count());
+    CHECK_EQ(0, shared->deopt_count());
+    CHECK_EQ(0, shared->deopt_loop_count());
+    CHECK_EQ(0, shared->profiler_ticks());
+    if (shared->HasBytecodeArray()) {
+      CHECK_EQ(0, shared->bytecode_array()->osr_loop_nesting_level());
+      CHECK_EQ(BytecodeArray::kNoAgeBytecodeAge,
+               shared->bytecode_array()->bytecode_age());
+    } else {
+      CHECK_EQ(0, shared->code()->allow_osr_at_loop_nesting_level());
+      CHECK_EQ(0, shared->code()->profiler_ticks());
+    }
+  }
+  isolate2->Dispose();
+}
+
+static void CompileRunInNewIsolate(const char* source, const char* name,
+                                   bool allow_compilation) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str(name));
+    v8::Local<v8::Script> script;
+    {
+      Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+      std::unique_ptr<DisallowCompilation> no_compile;
+      if (!allow_compilation) {
+        no_compile.reset(new DisallowCompilation(i_isolate));
+      }
+      script = v8::Script::Compile(context, v8_str(source), &origin)
+                   .ToLocalChecked();
+    }
+    CHECK(script->GetUnboundScript()
+              ->GetScriptName()
+              ->Equals(context, v8_str(name))
+              .FromJust());
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate->Dispose();
+}
+
+TEST(SharedCompilationCache) {
+  FLAG_serialize_toplevel = true;
+  FLAG_shared_compilation_cache = true;
+  FLAG_shared_compilation_cache_min_source_length = 0;
+  SharedCompilationCache* cache = SharedCompilationCache::Get();
+  cache->Clear();
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  CompileRunInNewIsolate(source, "first", true);
+  CHECK_EQ(1, cache->length());
+  CHECK_LT(0u, cache->size());
+
+  // Another isolate gets the script from the shared cache, with its own
+  // origin.
+  CompileRunInNewIsolate(source, "second", false);
+  CHECK_EQ(1, cache->length());
+  cache->Clear();
+}
+
+TEST(SharedCompilationCacheEviction) {
+  FLAG_shared_compilation_cache_size = 1;  // 1 KB.
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  SharedCompilationCache cache;
+  std::vector<byte> bytes(400, 0x2a);
+  ScriptData data(bytes.data(), static_cast<int>(bytes.size()));
+  Handle<String> a = isolate->factory()->NewStringFromAsciiChecked("'a'");
+  Handle<String> b = isolate->factory()->NewStringFromAsciiChecked("'b'");
+  Handle<String> c = isolate->factory()->NewStringFromAsciiChecked("'c'");
+
+  cache.Put(a, &data);
+  cache.Put(b, &data);
+  CHECK_EQ(2, cache.length());
+  // Looking up a makes b the least recently used entry.
+  std::unique_ptr<ScriptData> result(cache.Lookup(a));
+  CHECK_NOT_NULL(result.get());
+  CHECK_EQ(data.length(), result->length());
+  CHECK_EQ(0, memcmp(data.data(), result->data(), data.length()));
+
+  cache.Put(c, &data);
+  CHECK_EQ(2, cache.length());
+  CHECK_LE(cache.size(), static_cast<size_t>(KB));
+  CHECK_NULL(cache.Lookup(b));
+  result.reset(cache.Lookup(a));
+  CHECK_NOT_NULL(result.get());
+  result.reset(cache.Lookup(c));
+  CHECK_NOT_NULL(result.get());
+
+  // Entries larger than the whole cache are not added.
+  std::vector<byte> large_bytes(2 * KB, 0x2a);
+  ScriptData large_data(large_bytes.data(),
+                        static_cast<int>(large_bytes.size()));
+  cache.Put(b, &large_data);
+  CHECK_NULL(cache.Lookup(b));
+  CHECK_EQ(2, cache.length());
+
+  cache.Remove(a);
+  CHECK_NULL(cache.Lookup(a));
+  CHECK_EQ(1, cache.length());
+  cache.Remove(c);
+  CHECK_EQ(0, cache.length());
+  CHECK_EQ(0u, cache.size());
+  CHECK_NULL(cache.Lookup(c));
+}
+
 TEST(CodeSerializerBitFlip) {
   FLAG_serialize_toplevel = true;
 
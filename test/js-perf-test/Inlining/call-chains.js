@@ -0,0 +1,119 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Models the deep call chains of small accessor and dispatch functions that
+// are typical for frameworks. Every chain also contains rarely taken calls
+// to larger functions that compete with the hot calls for the inlining
+// budget.
+
+new BenchmarkSuite('CallChain', [1000], [
+  new Benchmark('CallChain', false, false, 0,
+                CallChain, CallChainSetup, CallChainTearDown),
+]);
+
+new BenchmarkSuite('Dispatch', [1000], [
+  new Benchmark('Dispatch', false, false, 0,
+                Dispatch, DispatchSetup, DispatchTearDown),
+]);
+
+var result;
+var components;
+
+// ----------------------------------------------------------------------------
+
+function Component(id) {
+  this.id = id;
+  this.props = { value: id, scale: 2 };
+  this.state = { dirty: false, renders: 0 };
+}
+
+Component.prototype.getProps = function() { return this.props; };
+Component.prototype.getValue = function() { return this.getProps().value; };
+Component.prototype.getScale = function() { return this.getProps().scale; };
+Component.prototype.isDirty = function() { return this.state.dirty; };
+
+Component.prototype.compute = function() {
+  return this.getValue() * this.getScale();
+};
+
+Component.prototype.update = function() {
+  // Rarely taken, and too large to be worth inlining into the hot path.
+  if (this.isDirty()) return this.rerender();
+  return this.compute();
+};
+
+Component.prototype.rerender = function() {
+  var state = this.state;
+  var props = this.props;
+  state.renders++;
+  state.dirty = false;
+  var acc = 0;
+  for (var i = 0; i < 8; i++) {
+    acc += (props.value + i) * props.scale;
+    if (acc > 1000000) acc = acc % 1000;
+  }
+  props.value = acc % 97;
+  if (state.renders % 3 === 0) props.scale = props.scale + 1;
+  if (props.scale > 4) props.scale = 2;
+  return this.compute();
+};
+
+function visit(component) { return component.update(); }
+function visitAll(list) {
+  var sum = 0;
+  for (var i = 0; i < list.length; i++) sum += visit(list[i]);
+  return sum;
+}
+function renderTree(list) { return visitAll(list); }
+function commit(list) { return renderTree(list); }
+
+function CallChainSetup() {
+  result = 0;
+  components = [];
+  for (var i = 0; i < 100; i++) components.push(new Component(i));
+}
+
+function CallChain() {
+  components[result % 100].state.dirty = true;
+  result += commit(components) & 0xff;
+}
+
+function CallChainTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+var handlers;
+
+function identity(x) { return x; }
+function double(x) { return x * 2; }
+function increment(x) { return x + 1; }
+function negate(x) { return -x; }
+function square(x) { return x * x; }
+
+// {apply} sees many different targets, but after it was inlined into each
+// pipeline stage the target is known again.
+function apply(fn, x) { return fn(x); }
+function stage1(x) { return apply(double, x); }
+function stage2(x) { return apply(increment, x); }
+function stage3(x) { return apply(identity, x); }
+function stage4(x) { return apply(negate, apply(negate, x)); }
+function pipeline(x) { return stage4(stage3(stage2(stage1(x)))); }
+
+function DispatchSetup() {
+  result = 0;
+  handlers = [identity, double, increment, negate, square];
+  for (var i = 0; i < handlers.length; i++) apply(handlers[i], i);
+}
+
+function Dispatch() {
+  var sum = 0;
+  for (var i = 0; i < 1000; i++) sum += pipeline(i);
+  result = sum;
+}
+
+function DispatchTearDown() {
+  return result === 1000 * 1000;
+}
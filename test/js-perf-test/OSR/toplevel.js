@@ -0,0 +1,52 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('TopLevelLoop', [100], [
+  new Benchmark('TopLevelLoop', false, false, 0,
+                TopLevelLoop, TopLevelLoopSetup, TopLevelLoopTearDown)
+]);
+
+new BenchmarkSuite('TopLevelNestedLoop', [100], [
+  new Benchmark('TopLevelNestedLoop', false, false, 0,
+                TopLevelNestedLoop, TopLevelLoopSetup, TopLevelLoopTearDown)
+]);
+
+// ----------------------------------------------------------------------------
+
+// Every run evaluates a fresh script, so the loop always starts out in
+// unoptimized code and has to be entered through on-stack replacement.
+
+var result;
+var expected;
+var counter = 0;
+
+function TopLevelLoopSetup() {}
+
+function TopLevelLoop() {
+  expected = 150000;
+  result = (0, eval)(
+      '/* ' + counter++ + ' */' +
+      'var sum = 0;' +
+      'for (var i = 0; i < 100000; i++) {' +
+      '  sum += (i * 3) & 3;' +
+      '}' +
+      'sum;');
+}
+
+function TopLevelNestedLoop() {
+  expected = 999000;
+  result = (0, eval)(
+      '/* ' + counter++ + ' */' +
+      'var sum = 0;' +
+      'for (var i = 0; i < 1000; i++) {' +
+      '  for (var j = 0; j < 1000; j++) {' +
+      '    sum += j == i ? 0 : 1;' +
+      '  }' +
+      '}' +
+      'sum;');
+}
+
+function TopLevelLoopTearDown() {
+  return result === expected;
+}
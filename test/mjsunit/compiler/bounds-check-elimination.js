@@ -0,0 +1,95 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-bounds-check-elimination
+
+(function() {
+  function sum(a) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  var a = [1, 2, 3, 4];
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(3, sum([1, 2]));
+})();
+
+(function() {
+  function sum(a) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  var a = new Float64Array([1.5, 2.5, 3]);
+  assertEquals(7, sum(a));
+  assertEquals(7, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(7, sum(a));
+})();
+
+(function() {
+  function fill(a, v) {
+    for (var i = 0; i < a.length; i++) a[i] = v;
+  }
+  var a = new Uint8Array(100);
+  fill(a, 1);
+  fill(a, 2);
+  %OptimizeFunctionOnNextCall(fill);
+  fill(a, 3);
+  assertEquals(3, a[0]);
+  assertEquals(3, a[99]);
+})();
+
+// The buffer is neutered inside of the loop, after the loop condition has
+// read the length, so the access still has to see that it is gone.
+(function() {
+  function sum(a, neuter) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) {
+      if (i == neuter) %ArrayBufferNeuter(a.buffer);
+      s += a[i];
+    }
+    return s;
+  }
+  var a = new Uint8Array(100);
+  assertEquals(0, sum(a, -1));
+  assertEquals(0, sum(a, -1));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(0, sum(a, -1));
+  assertEquals(NaN, sum(a, 50));
+})();
+
+// The array shrinks inside of the loop, so the length observed by the loop
+// condition does not cover the element access.
+(function() {
+  function f(a) {
+    var r = [];
+    for (var i = 0; i < a.length; i++) {
+      a.length = 1;
+      r.push(a[i]);
+    }
+    return r;
+  }
+  assertEquals([1], f([1, 2, 3]));
+  assertEquals([1], f([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([1], f([1, 2, 3]));
+})();
+
+// The index is compared against a different length than it is checked
+// against.
+(function() {
+  function f(a, b) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) s += b[i] | 0;
+    return s;
+  }
+  assertEquals(3, f([1, 2, 3], [1, 2]));
+  assertEquals(3, f([1, 2, 3], [1, 2]));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(3, f([1, 2, 3], [1, 2]));
+})();
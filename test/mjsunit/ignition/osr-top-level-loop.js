@@ -0,0 +1,42 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --no-turbo-from-bytecode
+
+// Long-running top-level loops are entered through on-stack replacement
+// from the interpreter, with the loop-carried values taken over from the
+// interpreter frame.
+
+var sum = 0;
+var text = "";
+for (var i = 0; i < 100000; i++) {
+  sum += i % 7;
+  if (i % 10000 == 0) text += i;
+  if (i == 500) %OptimizeOsr();
+}
+assertEquals(299995, sum);
+assertEquals("0100002000030000400005000060000700008000090000", text);
+
+// Nested loops, entering at the inner loop header.
+var product = 1;
+for (var i = 0; i < 100; i++) {
+  for (var j = 0; j < 1000; j++) {
+    if (i == 3 && j == 10) %OptimizeOsr();
+    product = (product * 31 + j) % 1000003;
+  }
+}
+assertEquals(product, (function() {
+  var p = 1;
+  for (var i = 0; i < 100; i++) {
+    for (var j = 0; j < 1000; j++) p = (p * 31 + j) % 1000003;
+  }
+  return p;
+})());
+
+// Entering a loop that is naturally hot, without a manual trigger.
+var count = 0;
+for (var i = 0; i < 3000000; i++) {
+  if ((i & 0xff) == 0) count++;
+}
+assertEquals(11719, count);
@@ -0,0 +1,99 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/accounting-allocator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace base {
+
+TEST(AccountingAllocatorTest, PoolDisabledByDefault) {
+  AccountingAllocator allocator;
+  void* memory = allocator.Allocate(8 * 1024);
+  ASSERT_NE(nullptr, memory);
+  EXPECT_EQ(8u * 1024, allocator.GetCurrentMemoryUsage());
+  allocator.Free(memory, 8 * 1024);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+TEST(AccountingAllocatorTest, RecyclesFreedBlocks) {
+  AccountingAllocator allocator;
+  allocator.ConfigurePool(1024 * 1024);
+  void* first = allocator.Allocate(16 * 1024);
+  ASSERT_NE(nullptr, first);
+  allocator.Free(first, 16 * 1024);
+  EXPECT_EQ(16u * 1024, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  void* second = allocator.Allocate(16 * 1024);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(16u * 1024, allocator.GetCurrentMemoryUsage());
+  allocator.Free(second, 16 * 1024);
+}
+
+TEST(AccountingAllocatorTest, SmallerRequestsUseLargeEnoughBlocks) {
+  AccountingAllocator allocator;
+  allocator.ConfigurePool(1024 * 1024);
+  void* memory = allocator.Allocate(16 * 1024);
+  ASSERT_NE(nullptr, memory);
+  allocator.Free(memory, 16 * 1024);
+  // A request for more than the pooled block must not be served from it.
+  void* larger = allocator.Allocate(16 * 1024 + 8);
+  EXPECT_NE(memory, larger);
+  EXPECT_EQ(16u * 1024, allocator.GetCurrentPoolSize());
+  // A smaller request can be served from it.
+  EXPECT_EQ(memory, allocator.Allocate(12 * 1024));
+  allocator.Free(memory, 12 * 1024);
+  allocator.Free(larger, 16 * 1024 + 8);
+}
+
+TEST(AccountingAllocatorTest, RespectsMaximumPoolSize) {
+  AccountingAllocator allocator;
+  allocator.ConfigurePool(32 * 1024);
+  void* a = allocator.Allocate(16 * 1024);
+  void* b = allocator.Allocate(16 * 1024);
+  void* c = allocator.Allocate(16 * 1024);
+  allocator.Free(a, 16 * 1024);
+  allocator.Free(b, 16 * 1024);
+  allocator.Free(c, 16 * 1024);
+  EXPECT_EQ(32u * 1024, allocator.GetCurrentPoolSize());
+}
+
+TEST(AccountingAllocatorTest, ClearPool) {
+  AccountingAllocator allocator;
+  allocator.ConfigurePool(1024 * 1024);
+  allocator.Free(allocator.Allocate(8 * 1024), 8 * 1024);
+  allocator.Free(allocator.Allocate(64 * 1024), 64 * 1024);
+  EXPECT_EQ(72u * 1024, allocator.GetCurrentPoolSize());
+  allocator.ClearPool();
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+TEST(AccountingAllocatorTest, DoesNotPoolOutOfRangeSizes) {
+  AccountingAllocator allocator;
+  allocator.ConfigurePool(8 * 1024 * 1024);
+  allocator.Free(allocator.Allocate(1024), 1024);
+  allocator.Free(allocator.Allocate(4 * 1024 * 1024), 4 * 1024 * 1024);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+TEST(AccountingAllocatorTest, ZoneKindUsage) {
+  AccountingAllocator allocator;
+  EXPECT_EQ(8u * 1024, allocator.AccountZoneMemory(
+                           AccountingAllocator::kParserZone, 8 * 1024));
+  EXPECT_EQ(16u * 1024, allocator.AccountZoneMemory(
+                            AccountingAllocator::kParserZone, 8 * 1024));
+  EXPECT_EQ(0u, allocator.AccountZoneMemory(AccountingAllocator::kParserZone,
+                                            -16 * 1024));
+  EXPECT_EQ(0u,
+            allocator.GetCurrentMemoryUsage(AccountingAllocator::kParserZone));
+  EXPECT_EQ(16u * 1024,
+            allocator.GetMaxMemoryUsage(AccountingAllocator::kParserZone));
+  EXPECT_EQ(0u,
+            allocator.GetMaxMemoryUsage(AccountingAllocator::kTurboFanZone));
+}
+
+}  // namespace base
+}  // namespace v8
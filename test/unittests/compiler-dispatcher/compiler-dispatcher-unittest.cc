@@ -0,0 +1,181 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "include/v8.h"
+#include "src/api.h"
+#include "src/flags.h"
+#include "src/isolate-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+typedef TestWithContext CompilerDispatcherTest;
+
+namespace {
+
+const char test_script[] =
+    "function g() {\n"
+    "  f = function(a) {\n"
+    "        for (var i = 0; i < 3; i++) { a += 20; }\n"
+    "        return a;\n"
+    "      }\n"
+    "  return f;\n"
+    "}\n"
+    "g();";
+
+class ScriptResource : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit ScriptResource(const std::string& data) : data_(data) {}
+  ~ScriptResource() override = default;
+
+  const char* data() const override { return data_.c_str(); }
+  size_t length() const override { return data_.length(); }
+
+ private:
+  std::string data_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScriptResource);
+};
+
+Handle<Object> RunJS(v8::Isolate* isolate, v8::Local<v8::String> source) {
+  return Utils::OpenHandle(
+      *v8::Script::Compile(isolate->GetCurrentContext(), source)
+           .ToLocalChecked()
+           ->Run(isolate->GetCurrentContext())
+           .ToLocalChecked());
+}
+
+Handle<Object> RunJS(v8::Isolate* isolate, const char* script) {
+  return RunJS(isolate, v8::String::NewFromUtf8(isolate, script,
+                                                v8::NewStringType::kNormal)
+                            .ToLocalChecked());
+}
+
+// Returns the lazily compiled function |f| defined by |test_script|, compiled
+// from an external string so that it can be parsed on a background thread.
+// Every call uses a distinct source so that the compilation cache never hands
+// out an already compiled function.
+Handle<JSFunction> CreateExternalFunction(v8::Isolate* isolate) {
+  static int counter = 0;
+  std::ostringstream script;
+  script << test_script << " // " << counter++;
+  v8::Local<v8::String> source =
+      v8::String::NewExternalOneByte(isolate, new ScriptResource(script.str()))
+          .ToLocalChecked();
+  return Handle<JSFunction>::cast(RunJS(isolate, source));
+}
+
+}  // namespace
+
+TEST_F(CompilerDispatcherTest, Construct) {
+  std::unique_ptr<CompilerDispatcher> dispatcher(
+      new CompilerDispatcher(i_isolate(), FLAG_stack_size));
+}
+
+TEST_F(CompilerDispatcherTest, IsEnqueued) {
+  CompilerDispatcher dispatcher(i_isolate(), FLAG_stack_size);
+  Handle<JSFunction> f = CreateExternalFunction(isolate());
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(dispatcher.Enqueue(f));
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared));
+  // A function is only enqueued once.
+  ASSERT_FALSE(dispatcher.Enqueue(f));
+  dispatcher.AbortAll();
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+}
+
+TEST_F(CompilerDispatcherTest, OnHeapSourceIsNotEnqueued) {
+  CompilerDispatcher dispatcher(i_isolate(), FLAG_stack_size);
+  Handle<JSFunction> f =
+      Handle<JSFunction>::cast(RunJS(isolate(), test_script));
+
+  ASSERT_FALSE(dispatcher.Enqueue(f));
+  ASSERT_FALSE(dispatcher.IsEnqueued(handle(f->shared(), i_isolate())));
+}
+
+TEST_F(CompilerDispatcherTest, FinishNow) {
+  CompilerDispatcher dispatcher(i_isolate(), FLAG_stack_size);
+  Handle<JSFunction> f = CreateExternalFunction(isolate());
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_FALSE(shared->is_compiled());
+  ASSERT_TRUE(dispatcher.Enqueue(f));
+  ASSERT_TRUE(dispatcher.FinishNow(f));
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+
+  Smi* value = Smi::cast(*RunJS(isolate(), "f(100);"));
+  ASSERT_TRUE(value == Smi::FromInt(160));
+}
+
+TEST_F(CompilerDispatcherTest, LazyCompileFinishesJob) {
+  CompilerDispatcher* dispatcher = i_isolate()->compiler_dispatcher();
+  Handle<JSFunction> f = CreateExternalFunction(isolate());
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher->Enqueue(f));
+  // The first call goes through the lazy compile path, which picks up the
+  // result of the background parse.
+  Smi* value = Smi::cast(*RunJS(isolate(), "f(100);"));
+  ASSERT_TRUE(value == Smi::FromInt(160));
+  ASSERT_FALSE(dispatcher->IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+}
+
+TEST_F(CompilerDispatcherTest, AbortAll) {
+  CompilerDispatcher dispatcher(i_isolate(), FLAG_stack_size);
+  Handle<JSFunction> f = CreateExternalFunction(isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(f));
+  dispatcher.AbortAll();
+  ASSERT_FALSE(dispatcher.IsEnqueued(handle(f->shared(), i_isolate())));
+
+  // The function still compiles lazily on its first call.
+  Smi* value = Smi::cast(*RunJS(isolate(), "f(100);"));
+  ASSERT_TRUE(value == Smi::FromInt(160));
+}
+
+TEST_F(CompilerDispatcherTest, OldestJobIsAbortedWhenFull) {
+  CompilerDispatcher dispatcher(i_isolate(), FLAG_stack_size);
+  int old_max_jobs = FLAG_compiler_dispatcher_max_jobs;
+  FLAG_compiler_dispatcher_max_jobs = 1;
+  Handle<JSFunction> f1 = CreateExternalFunction(isolate());
+  Handle<JSFunction> f2 = CreateExternalFunction(isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(f1));
+  ASSERT_TRUE(dispatcher.Enqueue(f2));
+  ASSERT_FALSE(dispatcher.IsEnqueued(handle(f1->shared(), i_isolate())));
+  ASSERT_TRUE(dispatcher.IsEnqueued(handle(f2->shared(), i_isolate())));
+  dispatcher.AbortAll();
+  FLAG_compiler_dispatcher_max_jobs = old_max_jobs;
+}
+
+TEST_F(CompilerDispatcherTest, JobDoesNotKeepFunctionAlive) {
+  CompilerDispatcher dispatcher(i_isolate(), FLAG_stack_size);
+  Handle<SharedFunctionInfo> shared;
+  {
+    HandleScope scope(i_isolate());
+    Handle<JSFunction> f = CreateExternalFunction(isolate());
+    shared = scope.CloseAndEscape(handle(f->shared(), i_isolate()));
+    ASSERT_TRUE(dispatcher.Enqueue(f));
+    RunJS(isolate(), "f = undefined;");
+  }
+  i_isolate()->heap()->CollectAllAvailableGarbage();
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  dispatcher.AbortAll();
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -10,6 +10,7 @@
 #include "src/compiler/machine-operator.h"
 #include "src/compiler/node.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -53,13 +54,15 @@ struct Counter {
 
 class LoopPeelingTest : public GraphTest {
  public:
-  LoopPeelingTest() : GraphTest(1), machine_(zone()) {}
+  LoopPeelingTest() : GraphTest(1), machine_(zone()), simplified_(zone()) {}
   ~LoopPeelingTest() override {}
 
  protected:
   MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
 
   MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
 
   LoopTree* GetLoopTree() {
     if (FLAG_trace_turbo_graph) {
@@ -520,6 +523,43 @@ TEST_F(LoopPeelingTest, SimpleLoopWithUnmarkedExit) {
   }
 }
 
+TEST_F(LoopPeelingTest, LoopWithInvariantCheck) {
+  Node* p0 = Parameter(0);
+  Node* p1 = Parameter(1);
+  Node* p2 = Parameter(2);
+  While w = NewWhile(p0);
+  Node* ephi =
+      graph()->NewNode(common()->EffectPhi(2), start(), start(), w.loop);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(), p1, p2, ephi, w.if_true);
+  ephi->ReplaceInput(1, check);
+  Node* exit_effect =
+      graph()->NewNode(common()->LoopExitEffect(), ephi, w.exit);
+  InsertReturn(p0, exit_effect, w.exit);
+
+  LoopTree* loop_tree = GetLoopTree();
+  LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+  EXPECT_TRUE(LoopPeeler::HasLoopInvariantChecks(loop_tree, loop));
+}
+
+TEST_F(LoopPeelingTest, LoopWithVariantCheck) {
+  Node* p0 = Parameter(0);
+  Node* p1 = Parameter(1);
+  While w = NewWhile(p0);
+  Counter c = NewCounter(&w, 0, 1);
+  Node* ephi =
+      graph()->NewNode(common()->EffectPhi(2), start(), start(), w.loop);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(), c.phi, p1, ephi, w.if_true);
+  ephi->ReplaceInput(1, check);
+  Node* exit_effect =
+      graph()->NewNode(common()->LoopExitEffect(), ephi, w.exit);
+  InsertReturn(c.exit_marker, exit_effect, w.exit);
+
+  LoopTree* loop_tree = GetLoopTree();
+  LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+  EXPECT_FALSE(LoopPeeler::HasLoopInvariantChecks(loop_tree, loop));
+}
 
 }  // namespace compiler
 }  // namespace internal
@@ -0,0 +1,218 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-variable-optimizer.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopVariableOptimizerTest : public GraphTest {
+ public:
+  LoopVariableOptimizerTest() : GraphTest(3), simplified_(zone()) {}
+  ~LoopVariableOptimizerTest() override {}
+
+ protected:
+  // A counting loop {for (i = 0; cond(i, length); i++)} with a CheckBounds
+  // node on either the body or the exit path.
+  struct CountingLoop {
+    Node* phi;
+    Node* length;
+    Node* loop;
+    Node* if_true;
+    Node* exit;
+  };
+
+  CountingLoop NewCountingLoop(const Operator* cond_op) {
+    Node* length = Parameter(0);
+    NodeProperties::SetType(length, Type::Unsigned30());
+    return NewCountingLoop(cond_op, length);
+  }
+
+  CountingLoop NewCountingLoop(const Operator* cond_op, Node* length) {
+    CountingLoop l;
+    l.length = length;
+    l.loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* zero = NumberConstant(0);
+    l.phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                             zero, zero, l.loop);
+    NodeProperties::SetType(l.phi, Type::Unsigned30());
+    Node* cond = graph()->NewNode(cond_op, l.phi, l.length);
+    Node* branch = graph()->NewNode(common()->Branch(), cond, l.loop);
+    l.if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    l.exit = graph()->NewNode(common()->LoopExit(), if_false, l.loop);
+    Node* inc = graph()->NewNode(simplified()->NumberAdd(), l.phi,
+                                 NumberConstant(1));
+    l.phi->ReplaceInput(1, inc);
+    l.loop->ReplaceInput(1, l.if_true);
+    return l;
+  }
+
+  Node* NewCheckBounds(Node* index, Node* length, Node* control) {
+    return graph()->NewNode(simplified()->CheckBounds(), index, length,
+                            start(), control);
+  }
+
+  // The length of {array} as computed for a typed array element access, which
+  // is zero if the array's buffer was neutered.
+  Node* NewTypedArrayLength(Node* array) {
+    Node* length = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSTypedArrayLength()), array,
+        start(), start());
+    Node* buffer = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSArrayBufferViewBuffer()),
+        array, start(), start());
+    Node* bit_field = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSArrayBufferBitField()),
+        buffer, start(), start());
+    Node* check = graph()->NewNode(
+        simplified()->NumberEqual(),
+        graph()->NewNode(simplified()->NumberBitwiseAnd(), bit_field,
+                         NumberConstant(JSArrayBuffer::WasNeutered::kMask)),
+        NumberConstant(0));
+    Node* select = graph()->NewNode(
+        common()->Select(MachineRepresentation::kTagged, BranchHint::kTrue),
+        check, length, NumberConstant(0));
+    NodeProperties::SetType(select, Type::Unsigned30());
+    return select;
+  }
+
+  Node* InsertReturn(Node* value, Node* effect, Node* control) {
+    Node* ret = graph()->NewNode(common()->Return(), value, effect, control);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+    return ret;
+  }
+
+  void EliminateRedundantBoundsChecks() {
+    LoopVariableOptimizer optimizer(graph(), common(), zone());
+    optimizer.Run();
+    optimizer.EliminateRedundantBoundsChecks(simplified());
+  }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(LoopVariableOptimizerTest, CheckBoundsDominatedByLoopCondition) {
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThan());
+  Node* check = NewCheckBounds(l.phi, l.length, l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_TRUE(check->IsDead());
+  EXPECT_EQ(l.phi, NodeProperties::GetValueInput(ret, 0));
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(ret));
+}
+
+TEST_F(LoopVariableOptimizerTest,
+       CheckBoundsDominatedBySpeculativeLoopCondition) {
+  CountingLoop l = NewCountingLoop(simplified()->SpeculativeNumberLessThan(
+      NumberOperationHint::kSignedSmall));
+  Node* check = NewCheckBounds(l.phi, l.length, l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_TRUE(check->IsDead());
+  EXPECT_EQ(l.phi, NodeProperties::GetValueInput(ret, 0));
+}
+
+TEST_F(LoopVariableOptimizerTest, CheckBoundsKeptForNonStrictCondition) {
+  // {i <= length} lets {i} reach {length}.
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThanOrEqual());
+  Node* check = NewCheckBounds(l.phi, l.length, l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_FALSE(check->IsDead());
+  EXPECT_EQ(check, NodeProperties::GetValueInput(ret, 0));
+}
+
+TEST_F(LoopVariableOptimizerTest, CheckBoundsKeptForIndexBeyondCondition) {
+  // {i + 1} can be equal to {length} even though {i < length}.
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThan());
+  Node* index =
+      graph()->NewNode(simplified()->NumberAdd(), l.phi, NumberConstant(1));
+  NodeProperties::SetType(index, Type::Unsigned30());
+  Node* check = NewCheckBounds(index, l.length, l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_FALSE(check->IsDead());
+  EXPECT_EQ(check, NodeProperties::GetValueInput(ret, 0));
+}
+
+TEST_F(LoopVariableOptimizerTest, CheckBoundsKeptOnLoopExit) {
+  // After the loop {i} is equal to {length}.
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThan());
+  Node* check = NewCheckBounds(l.phi, l.length, l.exit);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_FALSE(check->IsDead());
+  EXPECT_EQ(check, NodeProperties::GetValueInput(ret, 0));
+}
+
+TEST_F(LoopVariableOptimizerTest, CheckBoundsKeptForPossiblyNegativeIndex) {
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThan());
+  NodeProperties::SetType(l.phi, Type::Signed32());
+  Node* check = NewCheckBounds(l.phi, l.length, l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_FALSE(check->IsDead());
+  EXPECT_EQ(check, NodeProperties::GetValueInput(ret, 0));
+}
+
+TEST_F(LoopVariableOptimizerTest, TypedArrayCheckBoundsKeepsNeuteringCheck) {
+  // The loop condition and the access each compute the typed array's length
+  // from their own load of the buffer's bit field.
+  Node* array = Parameter(1);
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThan(),
+                                   NewTypedArrayLength(array));
+  NodeProperties::SetType(l.phi, Type::Range(0.0, V8_INFINITY, zone()));
+  Node* length = NewTypedArrayLength(array);
+  Node* check = NewCheckBounds(l.phi, length, l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_TRUE(check->IsDead());
+  EXPECT_EQ(l.phi, NodeProperties::GetValueInput(ret, 0));
+  Node* neutering_check = NodeProperties::GetEffectInput(ret);
+  EXPECT_EQ(IrOpcode::kCheckIf, neutering_check->opcode());
+  EXPECT_EQ(length->InputAt(0),
+            NodeProperties::GetValueInput(neutering_check, 0));
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(neutering_check));
+}
+
+TEST_F(LoopVariableOptimizerTest, TypedArrayCheckBoundsKeptForOtherArray) {
+  CountingLoop l = NewCountingLoop(simplified()->NumberLessThan(),
+                                   NewTypedArrayLength(Parameter(1)));
+  Node* check =
+      NewCheckBounds(l.phi, NewTypedArrayLength(Parameter(2)), l.if_true);
+  Node* ret = InsertReturn(check, check, l.exit);
+
+  EliminateRedundantBoundsChecks();
+
+  EXPECT_FALSE(check->IsDead());
+  EXPECT_EQ(check, NodeProperties::GetValueInput(ret, 0));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/compiler/pipeline.h"
+#include "src/compiler/register-allocator.h"
 #include "test/unittests/compiler/instruction-sequence-unittest.h"
 
 namespace v8 {
@@ -86,6 +87,18 @@ class RegisterAllocatorTest : public InstructionSequenceTest {
     WireBlocks();
     Pipeline::AllocateRegistersForTesting(config(), sequence(), true);
   }
+
+  RegisterAllocationData* BuildLiveRanges() {
+    WireBlocks();
+    RegisterAllocationData* data = new (zone())
+        RegisterAllocationData(config(), zone(), new (zone()) Frame(0),
+                               sequence());
+    ConstraintBuilder constraints(data);
+    constraints.MeetRegisterConstraints();
+    constraints.ResolvePhis();
+    LiveRangeBuilder(data, zone()).BuildLiveRanges();
+    return data;
+  }
 };
 
 
@@ -163,6 +176,34 @@ TEST_F(RegisterAllocatorTest, SimpleDiamond) {
 }
 
 
+TEST_F(RegisterAllocatorTest, SimpleDiamondLiveInSets) {
+  StartBlock();
+  auto param = Parameter();
+  EndBlock(Branch(Reg(param), 1, 2));
+
+  StartBlock();
+  EndBlock(Jump(2));
+
+  StartBlock();
+  EndBlock(Jump(1));
+
+  StartBlock();
+  Return(param);
+  EndBlock();
+
+  ZoneVector<BitVector*>& live_in_sets = BuildLiveRanges()->live_in_sets();
+  // The first successor falls through from its only predecessor, so its live
+  // in set is reused as the live out set of block 0.
+  EXPECT_EQ(live_in_sets[0], live_in_sets[1]);
+  // The other successor and the merge need their own sets for resolving
+  // control flow.
+  EXPECT_NE(live_in_sets[0], live_in_sets[2]);
+  EXPECT_NE(live_in_sets[2], live_in_sets[3]);
+  EXPECT_TRUE(live_in_sets[2]->Contains(param.value_));
+  EXPECT_TRUE(live_in_sets[3]->Contains(param.value_));
+}
+
+
 TEST_F(RegisterAllocatorTest, SimpleDiamondPhi) {
   // return i ? K1 : K2
   StartBlock();
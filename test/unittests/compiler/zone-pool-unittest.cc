@@ -30,6 +30,8 @@ class ZonePoolTest : public TestWithIsolate {
     ASSERT_EQ(total, stats->GetTotalAllocatedBytes());
   }
 
+  base::AccountingAllocator* allocator() { return &allocator_; }
+
   size_t Allocate(Zone* zone) {
     size_t bytes = rng.NextInt(25) + 7;
     size_t size_before = zone->allocation_size();
@@ -59,6 +61,26 @@ TEST_F(ZonePoolTest, Empty) {
 }
 
 
+TEST_F(ZonePoolTest, ZoneKind) {
+  {
+    ZonePool::Scope scope(zone_pool());
+    Allocate(scope.zone());
+    size_t turbofan = allocator()->GetCurrentMemoryUsage(
+        base::AccountingAllocator::kTurboFanZone);
+    EXPECT_LT(0u, turbofan);
+    // Changing the kind moves the zone's memory over.
+    scope.zone()->set_kind(base::AccountingAllocator::kRegisterAllocatorZone);
+    EXPECT_EQ(0u, allocator()->GetCurrentMemoryUsage(
+                      base::AccountingAllocator::kTurboFanZone));
+    EXPECT_EQ(turbofan, allocator()->GetCurrentMemoryUsage(
+                            base::AccountingAllocator::kRegisterAllocatorZone));
+  }
+  // Zones handed out again are attributed to TurboFan.
+  ZonePool::Scope scope(zone_pool());
+  EXPECT_EQ(base::AccountingAllocator::kTurboFanZone, scope.zone()->kind());
+}
+
+
 TEST_F(ZonePoolTest, MultipleZonesWithDeletion) {
   static const size_t kArraySize = 10;
 
@@ -29,6 +29,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <memory>
 #include <string>
 #include <vector>
 #include "src/v8.h"
@@ -58,11 +59,114 @@ class StringResource8 : public v8::String::ExternalOneByteStringResource {
   int length_;
 };
 
+// Hands out the raw bytes of the source file in fixed-size chunks, like an
+// embedder streaming a script from the network or disk would.
+class ChunkedSourceStream : public v8::ScriptCompiler::ExternalSourceStream {
+ public:
+  static const size_t kChunkSize = 64 * KB;
+
+  ChunkedSourceStream(const byte* data, size_t length)
+      : data_(data), length_(length), offset_(0) {}
+
+  virtual size_t GetMoreData(const uint8_t** src) {
+    size_t length = Min(kChunkSize, length_ - offset_);
+    if (length == 0) return 0;
+    // The caller takes ownership of the chunk.
+    uint8_t* chunk = new uint8_t[length];
+    memcpy(chunk, data_ + offset_, length);
+    offset_ += length;
+    *src = chunk;
+    return length;
+  }
+
+ private:
+  const byte* data_;
+  size_t length_;
+  size_t offset_;
+};
+
+v8::base::TimeDelta RunStreamingParser(const char* fname, Encoding encoding,
+                                       int repeat, v8::Isolate* isolate,
+                                       size_t* source_bytes) {
+  int length = 0;
+  const byte* source = ReadFileAndRepeat(fname, &length, repeat);
+  *source_bytes += length;
+  v8::ScriptCompiler::StreamedSource::Encoding stream_encoding =
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE;
+  switch (encoding) {
+    case UTF8:
+      stream_encoding = v8::ScriptCompiler::StreamedSource::UTF8;
+      break;
+    case UTF16:
+      stream_encoding = v8::ScriptCompiler::StreamedSource::TWO_BYTE;
+      break;
+    case LATIN1:
+      break;
+  }
+  v8::ScriptCompiler::StreamedSource streamed_source(
+      new ChunkedSourceStream(source, static_cast<size_t>(length)),
+      stream_encoding);
+  v8::ScriptCompiler::ScriptStreamingTask* task =
+      v8::ScriptCompiler::StartStreamingScript(isolate, &streamed_source);
+  // Run the background task synchronously, it parses straight from the
+  // chunks handed out by the source stream.
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  task->Run();
+  v8::base::TimeDelta parse_time = timer.Elapsed();
+  delete task;
+  delete[] source;
+  return parse_time;
+}
+
+v8::base::TimeDelta RunScanner(const char* fname, Encoding encoding,
+                               int repeat, v8::Isolate* isolate,
+                               size_t* source_bytes) {
+  int length = 0;
+  const byte* source = ReadFileAndRepeat(fname, &length, repeat);
+  *source_bytes += length;
+  std::unique_ptr<Utf16CharacterStream> stream;
+  std::unique_ptr<ChunkedSourceStream> source_stream;
+  switch (encoding) {
+    case LATIN1:
+      stream.reset(new ExternalOneByteStringUtf16CharacterStream(
+          reinterpret_cast<const char*>(source), static_cast<size_t>(length)));
+      break;
+    case UTF8:
+    case UTF16:
+      source_stream.reset(
+          new ChunkedSourceStream(source, static_cast<size_t>(length)));
+      stream.reset(new ExternalStreamingStream(
+          source_stream.get(),
+          encoding == UTF8 ? v8::ScriptCompiler::StreamedSource::UTF8
+                           : v8::ScriptCompiler::StreamedSource::TWO_BYTE));
+      break;
+  }
+  // Tokenize the whole source without parsing it. Regular expressions are
+  // not recognized as such, which is fine for measuring the scanner.
+  Scanner scanner(reinterpret_cast<i::Isolate*>(isolate)->unicode_cache());
+  v8::base::ElapsedTimer timer;
+  timer.Start();
+  scanner.Initialize(stream.get());
+  while (scanner.Next() != Token::EOS) {
+  }
+  v8::base::TimeDelta scan_time = timer.Elapsed();
+  stream.reset();
+  delete[] source;
+  return scan_time;
+}
+
+double ThroughputInMBPerSecond(size_t bytes, double milliseconds) {
+  if (milliseconds <= 0) return 0;
+  return static_cast<double>(bytes) / MB / (milliseconds / 1000);
+}
+
 std::pair<v8::base::TimeDelta, v8::base::TimeDelta> RunBaselineParser(
     const char* fname, Encoding encoding, int repeat, v8::Isolate* isolate,
-    v8::Local<v8::Context> context) {
+    v8::Local<v8::Context> context, size_t* source_bytes) {
   int length = 0;
   const byte* source = ReadFileAndRepeat(fname, &length, repeat);
+  *source_bytes += length;
   v8::Local<v8::String> source_handle;
   switch (encoding) {
     case UTF8: {
@@ -143,6 +247,8 @@ int main(int argc, char* argv[]) {
   std::vector<std::string> fnames;
   std::string benchmark;
   int repeat = 1;
+  bool stream = false;
+  bool scan = false;
   for (int i = 0; i < argc; ++i) {
     if (strcmp(argv[i], "--latin1") == 0) {
       encoding = LATIN1;
@@ -150,6 +256,10 @@ int main(int argc, char* argv[]) {
       encoding = UTF8;
     } else if (strcmp(argv[i], "--utf16") == 0) {
       encoding = UTF16;
+    } else if (strcmp(argv[i], "--stream") == 0) {
+      stream = true;
+    } else if (strcmp(argv[i], "--scan") == 0) {
+      scan = true;
     } else if (strncmp(argv[i], "--benchmark=", 12) == 0) {
       benchmark = std::string(argv[i]).substr(12);
     } else if (strncmp(argv[i], "--repeat=", 9) == 0) {
@@ -173,18 +283,48 @@ int main(int argc, char* argv[]) {
       v8::Context::Scope scope(context);
       double first_parse_total = 0;
       double second_parse_total = 0;
+      double stream_parse_total = 0;
+      double scan_total = 0;
+      size_t source_bytes = 0;
+      size_t stream_source_bytes = 0;
+      size_t scan_source_bytes = 0;
       for (size_t i = 0; i < fnames.size(); i++) {
         std::pair<v8::base::TimeDelta, v8::base::TimeDelta> time =
             RunBaselineParser(fnames[i].c_str(), encoding, repeat, isolate,
-                              context);
+                              context, &source_bytes);
         first_parse_total += time.first.InMillisecondsF();
         second_parse_total += time.second.InMillisecondsF();
+        if (stream) {
+          stream_parse_total +=
+              RunStreamingParser(fnames[i].c_str(), encoding, repeat, isolate,
+                                 &stream_source_bytes)
+                  .InMillisecondsF();
+        }
+        if (scan) {
+          scan_total += RunScanner(fnames[i].c_str(), encoding, repeat,
+                                   isolate, &scan_source_bytes)
+                            .InMillisecondsF();
+        }
       }
       if (benchmark.empty()) benchmark = "Baseline";
       printf("%s(FirstParseRunTime): %.f ms\n", benchmark.c_str(),
              first_parse_total);
       printf("%s(SecondParseRunTime): %.f ms\n", benchmark.c_str(),
              second_parse_total);
+      printf("%s(FirstParseThroughput): %.2f MB/s\n", benchmark.c_str(),
+             ThroughputInMBPerSecond(source_bytes, first_parse_total));
+      if (stream) {
+        printf("%s(StreamParseRunTime): %.f ms\n", benchmark.c_str(),
+               stream_parse_total);
+        printf("%s(StreamParseThroughput): %.2f MB/s\n", benchmark.c_str(),
+               ThroughputInMBPerSecond(stream_source_bytes,
+                                       stream_parse_total));
+      }
+      if (scan) {
+        printf("%s(ScanRunTime): %.f ms\n", benchmark.c_str(), scan_total);
+        printf("%s(ScanThroughput): %.2f MB/s\n", benchmark.c_str(),
+               ThroughputInMBPerSecond(scan_source_bytes, scan_total));
+      }
     }
   }
   v8::V8::Dispose();